@@ -0,0 +1,160 @@
+#pragma once
+
+#include "uint256_t_limbs.hpp"
+#include "uint512_t.hpp"
+
+#include <exception>
+#include <stdexcept>
+
+namespace crypto
+{
+
+// Barrett reduction modulo a 256-bit modulus m chosen at run time, following
+// Menezes et al., Handbook of Applied Cryptography, algorithm 14.42. With k the
+// number of limbs in m and b = 2^64, mu = floor(b^2k / m) is computed once; the
+// quotient of any x < b^2k is then estimated with two truncated multiplies, and
+// is never more than two too small. Unlike MontgomeryContext the modulus may be
+// even and values stay in their ordinary form, so the setup cost is a single division.
+class BarrettReducer
+{
+  public:
+    BarrettReducer(const uint256_t& modulus);
+    ~BarrettReducer() = default;
+
+    // x mod m for any x; products of two values below m take the fast path
+    uint256_t Reduce(const uint512_t& number) const;
+    uint256_t Multiply(const uint256_t& lhs, const uint256_t& rhs) const;
+    uint256_t Square(const uint256_t& number) const;
+
+    uint256_t Modulus;
+
+  private:
+    // Number of significant limbs in the modulus
+    int Limbs;
+    // floor(b^2k / m), clamped to k + 1 limbs
+    uint64_t Mu[5];
+};
+
+inline BarrettReducer::BarrettReducer(const uint256_t& modulus)
+  : Modulus(modulus)
+  , Limbs(0)
+  , Mu{0, 0, 0, 0, 0}
+{
+    if (Modulus < 2)
+    {
+        throw std::runtime_error("Barrett modulus must be greater than 1");
+    }
+
+    const uint64_t m[4] = {Modulus.limb(0), Modulus.limb(1), Modulus.limb(2), Modulus.limb(3)};
+    Limbs = uint256_limbs::significant(m, 4);
+
+    uint64_t power[9] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+    power[2 * Limbs] = 1;
+    uint64_t quotient[9] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+    uint64_t remainder[4] = {0, 0, 0, 0};
+    uint256_limbs::divmod<9>(power, 2 * Limbs + 1, m, Limbs, quotient, remainder);
+    for (int i = 0; i <= Limbs; i++)
+    {
+        Mu[i] = quotient[i];
+    }
+
+    // m = b^(k-1) is the one modulus whose mu needs k + 2 limbs. Using b^(k+1) - 1 instead
+    // leaves the quotient estimate at most one further below, costing a third subtraction
+    if (quotient[Limbs + 1])
+    {
+        for (int i = 0; i <= Limbs; i++)
+        {
+            Mu[i] = ~(uint64_t)0;
+        }
+    }
+}
+
+inline uint256_t BarrettReducer::Reduce(const uint512_t& number) const
+{
+    using uint256_limbs::dlimb_t;
+
+    const int k = Limbs;
+    const uint64_t x[8] = {number.limb(0), number.limb(1), number.limb(2), number.limb(3),
+                           number.limb(4), number.limb(5), number.limb(6), number.limb(7)};
+    if (uint256_limbs::significant(x, 8) > 2 * k)
+    {
+        return number % Modulus;
+    }
+
+    // q2 = floor(x / b^(k-1)) * mu; only its limbs from k + 1 upwards are used
+    uint64_t q2[10] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+    for (int i = 0; i <= k; i++)
+    {
+        const uint64_t a = x[k - 1 + i];
+        uint64_t carry = 0;
+        for (int j = 0; j <= k; j++)
+        {
+            const dlimb_t sum = (dlimb_t)a * Mu[j] + q2[i + j] + carry;
+            q2[i + j] = (uint64_t)sum;
+            carry = (uint64_t)(sum >> 64);
+        }
+        q2[i + k + 1] = carry;
+    }
+    const uint64_t* q3 = q2 + k + 1;
+
+    // r = x - q3 * m, computed mod b^(k+1) where the true difference is known to lie
+    uint64_t r[5] = {0, 0, 0, 0, 0};
+    for (int i = 0; i <= k; i++)
+    {
+        r[i] = x[i];
+    }
+    uint64_t product[5] = {0, 0, 0, 0, 0};
+    for (int i = 0; i <= k; i++)
+    {
+        uint64_t carry = 0;
+        for (int j = 0; i + j <= k && j < k; j++)
+        {
+            const dlimb_t sum = (dlimb_t)q3[i] * Modulus.limb(j) + product[i + j] + carry;
+            product[i + j] = (uint64_t)sum;
+            carry = (uint64_t)(sum >> 64);
+        }
+        if (i == 0)
+        {
+            product[k] = carry;
+        }
+    }
+    uint64_t borrow = 0;
+    for (int i = 0; i <= k; i++)
+    {
+        r[i] = uint256_limbs::subb(r[i], product[i], borrow, borrow);
+    }
+
+    // At most two subtractions of m remain, three when mu was clamped
+    const uint64_t m[5] = {Modulus.limb(0), Modulus.limb(1), Modulus.limb(2), Modulus.limb(3), 0};
+    for (int round = 0; round < 3; round++)
+    {
+        uint64_t diff[5] = {0, 0, 0, 0, 0};
+        borrow = 0;
+        for (int i = 0; i <= k; i++)
+        {
+            diff[i] = uint256_limbs::subb(r[i], m[i], borrow, borrow);
+        }
+        if (borrow)
+        {
+            break;
+        }
+        for (int i = 0; i <= k; i++)
+        {
+            r[i] = diff[i];
+        }
+    }
+
+    return uint256_t(r[3], r[2], r[1], r[0]);
+}
+
+inline uint256_t BarrettReducer::Multiply(const uint256_t& lhs, const uint256_t& rhs) const
+{
+    return Reduce(lhs.mul_wide(rhs));
+}
+
+inline uint256_t BarrettReducer::Square(const uint256_t& number) const
+{
+    return Reduce(number.sqr_wide());
+}
+
+} // namespace crypto
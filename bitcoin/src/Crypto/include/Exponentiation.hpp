@@ -0,0 +1,73 @@
+#pragma once
+
+#include "uint256_t.hpp"
+
+#include <algorithm>
+
+namespace crypto
+{
+
+// Left to right sliding window exponentiation with a uint256_t exponent, over any
+// multiply and square that keep their values as uint256_t (plain residues, Montgomery
+// form, ...). The odd powers base^1, base^3, ..., base^(2^w - 1) are computed up front,
+// after which every run of up to w exponent bits ending in a one costs a single multiply.
+// one is the identity of the multiply and is returned for a zero exponent.
+template<class Multiply, class Square>
+uint256_t SlidingWindowPower(const uint256_t& base, const uint256_t& exponent, const uint256_t& one, Multiply multiply,
+                             Square square)
+{
+    // Wider windows only pay for their table on longer exponents
+    const int bits = exponent.bits();
+    const int window = bits > 160 ? 5 : bits > 48 ? 4 : bits > 12 ? 3 : 1;
+
+    uint256_t odd[16];
+    odd[0] = base;
+    if (window > 1)
+    {
+        const uint256_t squared = square(base);
+        for (int i = 1; i < (1 << (window - 1)); i++)
+        {
+            odd[i] = multiply(odd[i - 1], squared);
+        }
+    }
+
+    // The result stays implicit until the first window, so that one is never squared
+    uint256_t result = one;
+    bool started = false;
+    int bit = bits - 1;
+    while (bit >= 0)
+    {
+        if (!exponent.test_bit(bit))
+        {
+            if (started)
+                result = square(result);
+            bit--;
+            continue;
+        }
+
+        // The widest window starting here that ends in a set bit
+        int low = std::max(bit - window + 1, 0);
+        while (!exponent.test_bit(low))
+        {
+            low++;
+        }
+        const uint64_t value = exponent.bit_window(low, bit - low + 1);
+        if (started)
+        {
+            for (int i = low; i <= bit; i++)
+            {
+                result = square(result);
+            }
+            result = multiply(result, odd[value >> 1]);
+        }
+        else
+        {
+            result = odd[value >> 1];
+            started = true;
+        }
+        bit = low - 1;
+    }
+    return result;
+}
+
+} // namespace crypto
@@ -2,38 +2,146 @@
 
 #include "Helpers.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <exception>
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
 
 namespace crypto
 {
 
-template<class T> class FieldElement
+// Where a FieldElement finds its prime. By default every element carries its own copy, so elements of
+// different fields share one type and are told apart at run time.
+template<class T> class RuntimePrime
 {
   public:
+    explicit RuntimePrime(T prime)
+      : Prime(prime)
+    {
+    }
+
+    T Prime;
+};
+
+// Any other Field is a policy with a `static constexpr T Prime`, such as
+//
+//     struct F223 { static constexpr int Prime = 223; };
+//
+// which fixes the prime at compile time. Elements are then the size of their number, mixing fields is a
+// type error rather than a runtime check, and every reduction sees the prime as a constant.
+template<class T, class Field = RuntimePrime<T>> class FieldElement : public Field
+{
+  public:
+    // For a compile time Field, prime must match Field::Prime
     FieldElement(T number, T prime);
+    // An element of the same field as field
+    FieldElement(T number, const Field& field);
+    // Only for a compile time Field
+    explicit FieldElement(T number);
     ~FieldElement() = default;
 
+    // An element of the same field as field, from a number the caller knows to be in [0, Prime)
+    static FieldElement Trusted(T number, const Field& field);
+
+    // Whether the prime is fixed by the type
+    static constexpr bool StaticPrime = !std::is_same<Field, RuntimePrime<T>>::value;
+
+    // The element times itself, through the dedicated squaring kernel where T has one
+    FieldElement Square() const;
+    // Multiplicative inverse, throws for zero
+    FieldElement Inverse() const;
+    // Whether the element has a square root, which zero does
+    bool IsSquare() const;
+    // A square root, throws if there is none. The other root is its negation
+    FieldElement Sqrt() const;
+    // Whether both elements belong to the same field, known at compile time for a static prime
+    static bool SameField(const FieldElement& lhs, const FieldElement& rhs);
+
     template<class U> friend bool operator==(const FieldElement& lhs, const FieldElement& rhs);
     template<class U> friend bool operator!=(const FieldElement& lhs, const FieldElement& rhs);
     template<class U> friend FieldElement operator+(const FieldElement& lhs, const FieldElement& rhs);
     template<class U> friend FieldElement operator-(const FieldElement& lhs, const FieldElement& rhs);
     template<class U> friend FieldElement operator*(const FieldElement& lhs, const FieldElement& rhs);
-    // Note: Bitwise OR is commandeered for the power operator
-    template<class U> friend FieldElement operator^(const FieldElement& lhs, const int& power);
     template<class U> friend FieldElement operator/(const FieldElement& lhs, const FieldElement& rhs);
     template<class U> friend std::ostream& operator<<(std::ostream& os, const FieldElement& element);
 
     T Number;
-    T Prime;
+    using Field::Prime;
+
+  private:
+    FieldElement(TrustedTag, T number, const Field& field);
+
+    static Field MakeField(const T& prime);
+    void CheckRange() const;
 };
 
-template<class T>
-FieldElement<T>::FieldElement(T number, T prime)
-  : Number(number)
-  , Prime(prime)
+template<class T> FieldElement(T number, T prime) -> FieldElement<T>;
+
+template<class T, class Field>
+FieldElement<T, Field>::FieldElement(T number, T prime)
+  : Field(MakeField(prime))
+  , Number(number)
+{
+    CheckRange();
+}
+
+template<class T, class Field>
+FieldElement<T, Field>::FieldElement(T number, const Field& field)
+  : Field(field)
+  , Number(number)
+{
+    CheckRange();
+}
+
+template<class T, class Field>
+FieldElement<T, Field>::FieldElement(T number)
+  : Field()
+  , Number(number)
+{
+    static_assert(StaticPrime, "A FieldElement with a runtime prime needs the prime");
+    CheckRange();
+}
+
+template<class T, class Field>
+FieldElement<T, Field>::FieldElement(TrustedTag, T number, const Field& field)
+  : Field(field)
+  , Number(number)
+{
+#ifdef CRYPTO_VALIDATE_TRUSTED
+    CheckRange();
+#endif
+}
+
+template<class T, class Field>
+FieldElement<T, Field> FieldElement<T, Field>::Trusted(T number, const Field& field)
+{
+    return FieldElement(TrustedTag(), number, field);
+}
+
+template<class T, class Field> Field FieldElement<T, Field>::MakeField(const T& prime)
+{
+    if constexpr (StaticPrime)
+    {
+        if (prime != Field::Prime)
+        {
+            std::stringstream error;
+            error << "Prime " << prime << " does not match the field prime " << Field::Prime << ".";
+            throw std::runtime_error(error.str());
+        }
+        return Field();
+    }
+    else
+    {
+        return Field(prime);
+    }
+}
+
+template<class T, class Field> void FieldElement<T, Field>::CheckRange() const
 {
     // Valid between 0 and N-1
     if (Number < 0 || Number >= Prime)
@@ -44,77 +152,230 @@ FieldElement<T>::FieldElement(T number, T prime)
     }
 }
 
-template<class T> bool operator==(const FieldElement<T>& lhs, const FieldElement<T>& rhs)
+template<class T, class Field> bool FieldElement<T, Field>::SameField(const FieldElement& lhs, const FieldElement& rhs)
+{
+    if constexpr (StaticPrime)
+        return true;
+    else
+        return lhs.Prime == rhs.Prime;
+}
+
+template<class T, class Field> FieldElement<T, Field> FieldElement<T, Field>::Square() const
+{
+    return Trusted(SquareModulo(Number, Prime), *this);
+}
+
+template<class T, class Field> FieldElement<T, Field> FieldElement<T, Field>::Inverse() const
+{
+    return Trusted(InverseModulo(Number, Prime), *this);
+}
+
+template<class T, class Field> bool FieldElement<T, Field>::IsSquare() const
+{
+    return Prime == 2 || JacobiSymbol(Number, Prime) >= 0;
+}
+
+template<class T, class Field> FieldElement<T, Field> FieldElement<T, Field>::Sqrt() const
+{
+    if (Number == 0 || Prime == 2)
+        return *this;
+    if (JacobiSymbol(Number, Prime) != 1)
+    {
+        std::stringstream error;
+        error << "Number " << Number << " has no square root modulo " << Prime << ".";
+        throw std::runtime_error(error.str());
+    }
+
+    // For p = 3 (mod 4), a^((p+1)/4) squares to a^((p+1)/2) = a * a^((p-1)/2) = a
+    if ((Prime & 3) == 3)
+        return Trusted(PowerModulo(Number, T((Prime >> 2) + 1), Prime), *this);
+
+    // Tonelli-Shanks: write p - 1 = q * 2^s with q odd
+    T q = Prime - 1;
+    int s = 0;
+    while ((q & 1) == 0)
+    {
+        q = q >> 1;
+        s++;
+    }
+
+    // Any non-residue z gives c = z^q, a generator of the 2-Sylow subgroup
+    T z = 2;
+    while (JacobiSymbol(z, Prime) != -1)
+    {
+        z = z + 1;
+    }
+
+    // Invariant: root^2 = a * t, with t of order dividing 2^m. Each round halves the order of t
+    int m = s;
+    T c = PowerModulo(z, q, Prime);
+    T t = PowerModulo(Number, q, Prime);
+    T root = PowerModulo(Number, T((q + 1) >> 1), Prime);
+    while (t != 1)
+    {
+        int i = 0;
+        for (T power = t; power != 1; i++)
+        {
+            power = MultiplyModulo(power, power, Prime);
+        }
+        T b = c;
+        for (int j = 0; j < m - i - 1; j++)
+        {
+            b = MultiplyModulo(b, b, Prime);
+        }
+        m = i;
+        c = MultiplyModulo(b, b, Prime);
+        t = MultiplyModulo(t, c, Prime);
+        root = MultiplyModulo(root, b, Prime);
+    }
+    return Trusted(root, *this);
+}
+
+template<class T, class Field> bool operator==(const FieldElement<T, Field>& lhs, const FieldElement<T, Field>& rhs)
 {
-    return lhs.Number == rhs.Number && lhs.Prime == rhs.Prime;
+    return lhs.Number == rhs.Number && FieldElement<T, Field>::SameField(lhs, rhs);
 }
 
-template<class T> bool operator!=(const FieldElement<T>& lhs, const FieldElement<T>& rhs)
+template<class T, class Field> bool operator!=(const FieldElement<T, Field>& lhs, const FieldElement<T, Field>& rhs)
 {
     return !(lhs == rhs);
 }
 
-template<class T> FieldElement<T> operator+(const FieldElement<T>& lhs, const FieldElement<T>& rhs)
+template<class T, class Field>
+FieldElement<T, Field> operator+(const FieldElement<T, Field>& lhs, const FieldElement<T, Field>& rhs)
 {
     // Elements must be in the same finite field, otherwise the calculation is meaningless
-    if (lhs.Prime != rhs.Prime)
+    if (!FieldElement<T, Field>::SameField(lhs, rhs))
     {
         throw std::runtime_error("Cannot add two numbers in different fields");
     }
 
-    auto number = (lhs.Number + rhs.Number) % lhs.Prime;
-    return FieldElement<T>(number, lhs.Prime);
+    auto number = AddModulo(lhs.Number, rhs.Number, lhs.Prime);
+    return FieldElement<T, Field>::Trusted(number, lhs);
 }
 
-template<class T> FieldElement<T> operator-(const FieldElement<T>& lhs, const FieldElement<T>& rhs)
+template<class T, class Field>
+FieldElement<T, Field> operator-(const FieldElement<T, Field>& lhs, const FieldElement<T, Field>& rhs)
 {
     // Elements must be in the same finite field, otherwise the calculation is meaningless
-    if (lhs.Prime != rhs.Prime)
+    if (!FieldElement<T, Field>::SameField(lhs, rhs))
     {
         throw std::runtime_error("Cannot substract two numbers in different fields");
     }
 
-    // Negative lhs % in C++ results in a negative rhs. Make lhs positive before the modulus
-    auto number = (lhs.Prime + (lhs.Number - rhs.Number)) % lhs.Prime;
-    return FieldElement<T>(number, lhs.Prime);
+    // Never goes negative, so it is safe for unsigned T
+    auto number = SubtractModulo(lhs.Number, rhs.Number, lhs.Prime);
+    return FieldElement<T, Field>::Trusted(number, lhs);
 }
 
-template<class T> FieldElement<T> operator*(const FieldElement<T>& lhs, const FieldElement<T>& rhs)
+template<class T, class Field>
+FieldElement<T, Field> operator*(const FieldElement<T, Field>& lhs, const FieldElement<T, Field>& rhs)
 {
     // Elements must be in the same finite field, otherwise the calculation is meaningless
-    if (lhs.Prime != rhs.Prime)
+    if (!FieldElement<T, Field>::SameField(lhs, rhs))
     {
         throw std::runtime_error("Cannot multiply two numbers in different fields");
     }
 
-    auto number = (lhs.Number * rhs.Number) % lhs.Prime;
-    return FieldElement<T>(number, lhs.Prime);
+    auto number = MultiplyModulo(lhs.Number, rhs.Number, lhs.Prime);
+    return FieldElement<T, Field>::Trusted(number, lhs);
 }
 
-template<class T> FieldElement<T> operator^(const FieldElement<T>& lhs, const int& power)
+// Note: Bitwise XOR is commandeered for the power operator. The power can be any integer type, signed or not,
+// up to uint256_t, and costs a single remainder to normalize
+template<class T, class Field, class E, class = std::enable_if_t<std::is_integral<E>::value>>
+FieldElement<T, Field> operator^(const FieldElement<T, Field>& lhs, const E& power)
 {
-    // a^(p-1) = 1, so exploit this to force the power to be positive
-    auto exponent = power;
-    while (exponent < 0)
-        exponent += lhs.Prime - 1;
-    auto number = PowerModulo(lhs.Number, exponent, lhs.Prime);
-    return FieldElement<T>(number, lhs.Prime);
+    auto number = PowerModulo(lhs.Number, FieldExponent(power, lhs.Prime), lhs.Prime);
+    return FieldElement<T, Field>::Trusted(number, lhs);
 }
 
-template<class T> FieldElement<T> operator/(const FieldElement<T>& lhs, const FieldElement<T>& rhs)
+template<class T, class Field>
+FieldElement<T, Field> operator/(const FieldElement<T, Field>& lhs, const FieldElement<T, Field>& rhs)
 {
     // Elements must be in the same finite field, otherwise the calculation is meaningless
-    if (lhs.Prime != rhs.Prime)
+    if (!FieldElement<T, Field>::SameField(lhs, rhs))
     {
         throw std::runtime_error("Cannot divide two numbers in different fields");
     }
 
-    // Fermat's Little Theorem: Number^(Prime-1) % Prime == 1, or 1/Number == pow(Number, Prime - 2, Prime)
-    auto number = (lhs.Number * (PowerModulo(rhs.Number, lhs.Prime - 2, lhs.Prime))) % lhs.Prime;
-    return FieldElement<T>(number, lhs.Prime);
+    auto number = MultiplyModulo(lhs.Number, rhs.Inverse().Number, lhs.Prime);
+    return FieldElement<T, Field>::Trusted(number, lhs);
+}
+
+// Replaces each of count elements with its inverse using Montgomery's trick: one inversion and
+// 3(N-1) multiplications for the N non-zero elements. Zero has no inverse and is left as zero.
+// With threads > 1 the elements are split into that many chunks, each inverted on its own thread
+template<class T, class Field>
+void BatchInvert(FieldElement<T, Field>* elements, const std::size_t count, const unsigned int threads = 1)
+{
+    if (threads > 1 && count > 1)
+    {
+        // Errors are carried back to the calling thread, as the single threaded path would throw them
+        const std::size_t chunk = (count + threads - 1) / threads;
+        std::vector<std::thread> workers;
+        std::vector<std::exception_ptr> errors((count + chunk - 1) / chunk);
+        for (std::size_t begin = 0; begin < count; begin += chunk)
+        {
+            const std::size_t size = std::min(chunk, count - begin);
+            std::exception_ptr& error = errors[begin / chunk];
+            workers.emplace_back([elements, begin, size, &error]() {
+                try
+                {
+                    BatchInvert(elements + begin, size, 1);
+                }
+                catch (...)
+                {
+                    error = std::current_exception();
+                }
+            });
+        }
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+        for (const auto& error : errors)
+        {
+            if (error)
+                std::rethrow_exception(error);
+        }
+        return;
+    }
+
+    // prefix[k] is the product of the first k + 1 non-zero elements, found at position[0..k]
+    std::vector<FieldElement<T, Field>> prefix;
+    std::vector<std::size_t> position;
+    prefix.reserve(count);
+    position.reserve(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        if (elements[i].Number == 0)
+            continue;
+        prefix.push_back(prefix.empty() ? elements[i] : prefix.back() * elements[i]);
+        position.push_back(i);
+    }
+    if (prefix.empty())
+        return;
+
+    // Walk back down, peeling one element off the inverted running product at a time
+    auto inverse = prefix.back().Inverse();
+    for (std::size_t k = prefix.size() - 1; k > 0; k--)
+    {
+        auto& element = elements[position[k]];
+        const auto result = inverse * prefix[k - 1];
+        inverse = inverse * element;
+        element = result;
+    }
+    elements[position[0]] = inverse;
+}
+
+template<class T, class Field>
+void BatchInvert(std::vector<FieldElement<T, Field>>& elements, const unsigned int threads = 1)
+{
+    BatchInvert(elements.data(), elements.size(), threads);
 }
 
-template<class T> std::ostream& operator<<(std::ostream& os, const FieldElement<T>& element)
+template<class T, class Field> std::ostream& operator<<(std::ostream& os, const FieldElement<T, Field>& element)
 {
     // Write FieldElement to stream
     os << "FieldElement_" << element.Prime << "(" << element.Number << ")";
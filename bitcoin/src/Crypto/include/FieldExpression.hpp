@@ -0,0 +1,214 @@
+#pragma once
+
+#include "FieldElement.hpp"
+#include "Helpers.hpp"
+#include "uint256_t.hpp"
+#include "uint512_t.hpp"
+#include "wide_uint.hpp"
+
+#include <stdexcept>
+
+namespace crypto
+{
+
+// Exact accumulator for the products, sums and differences of a formula, so that the whole formula is
+// reduced once instead of after every step. Only worth it where a reduction is a long division; other
+// number types keep each term reduced as it is added.
+template<class T> struct FieldAccumulator
+{
+    static constexpr bool Enabled = false;
+    typedef T Wide;
+};
+
+template<> struct FieldAccumulator<uint256_t>
+{
+    static constexpr bool Enabled = true;
+
+    // Products need 512 bits, and the spare limb leaves room for 2^64 of them
+    typedef wide_uint<576> Wide;
+
+    static Wide Widen(const uint256_t& number)
+    {
+        return Wide(number);
+    }
+
+    static Wide Multiply(const uint256_t& a, const uint256_t& b)
+    {
+        return Wide(uint512_t(a.mul_wide(b)));
+    }
+
+    static Wide Square(const uint256_t& a)
+    {
+        return Wide(uint512_t(a.sqr_wide()));
+    }
+
+    // (positive - negative) % prime
+    static uint256_t Reduce(const Wide& positive, const Wide& negative, const uint256_t& prime)
+    {
+        if (positive >= negative)
+            return Modulo(positive - negative, prime);
+        const uint256_t remainder = Modulo(negative - positive, prime);
+        return remainder == 0 ? remainder : prime - remainder;
+    }
+
+  private:
+    static uint256_t Modulo(Wide value, const uint256_t& prime)
+    {
+        // Sums and differences of a few reduced elements only need a few subtractions
+        const Wide modulus(prime);
+        if (value.bits() <= prime.bits() + 4u)
+        {
+            while (value >= modulus)
+                value -= modulus;
+            return uint256_t(value);
+        }
+        // Anything up to a single product takes the same division as mulmod
+        if (!value.limb(8))
+            return uint512_t(uint256_t(value >> 256), uint256_t(value)) % prime;
+        return uint256_t(value % modulus);
+    }
+};
+
+// A sum of products of field elements, built one term at a time and reduced once when it is evaluated:
+//
+//     auto result = FieldExpression<T, Field>(a).AddProduct(a, b).AddProduct(c, d).Subtract(e).Evaluate();
+//
+// costs one reduction for a*b + c*d - e instead of three. The terms are copied in as they are added, so an
+// expression never refers to the elements it was built from.
+template<class T, class Field> class FieldExpression : public Field
+{
+  public:
+    typedef FieldElement<T, Field> Element;
+
+    // An empty sum over the same field as field
+    explicit FieldExpression(const Field& field);
+    ~FieldExpression() = default;
+
+    FieldExpression& Add(const Element& element);
+    FieldExpression& Subtract(const Element& element);
+    FieldExpression& AddProduct(const Element& lhs, const Element& rhs);
+    FieldExpression& SubtractProduct(const Element& lhs, const Element& rhs);
+    // element * element, through the squaring kernel
+    FieldExpression& AddSquare(const Element& element);
+    FieldExpression& SubtractSquare(const Element& element);
+
+    // The reduced value of the sum
+    Element Evaluate() const;
+
+    using Field::Prime;
+
+  private:
+    typedef FieldAccumulator<T> Accumulator;
+    typedef typename Accumulator::Wide Wide;
+
+    // Exact sums of the added and subtracted terms where T has an accumulator, reduced sums otherwise
+    Wide Positive;
+    Wide Negative;
+
+    void CheckField(const Element& element, const char* error) const;
+    void Accumulate(Wide& sum, const Element& element);
+    void AccumulateProduct(Wide& sum, const Element& lhs, const Element& rhs);
+    void AccumulateSquare(Wide& sum, const Element& element);
+};
+
+template<class T, class Field>
+FieldExpression<T, Field>::FieldExpression(const Field& field)
+  : Field(field)
+  , Positive()
+  , Negative()
+{
+}
+
+template<class T, class Field> FieldExpression<T, Field>& FieldExpression<T, Field>::Add(const Element& element)
+{
+    CheckField(element, "Cannot add two numbers in different fields");
+    Accumulate(Positive, element);
+    return *this;
+}
+
+template<class T, class Field> FieldExpression<T, Field>& FieldExpression<T, Field>::Subtract(const Element& element)
+{
+    CheckField(element, "Cannot substract two numbers in different fields");
+    Accumulate(Negative, element);
+    return *this;
+}
+
+template<class T, class Field>
+FieldExpression<T, Field>& FieldExpression<T, Field>::AddProduct(const Element& lhs, const Element& rhs)
+{
+    CheckField(lhs, "Cannot multiply two numbers in different fields");
+    CheckField(rhs, "Cannot multiply two numbers in different fields");
+    AccumulateProduct(Positive, lhs, rhs);
+    return *this;
+}
+
+template<class T, class Field>
+FieldExpression<T, Field>& FieldExpression<T, Field>::SubtractProduct(const Element& lhs, const Element& rhs)
+{
+    CheckField(lhs, "Cannot multiply two numbers in different fields");
+    CheckField(rhs, "Cannot multiply two numbers in different fields");
+    AccumulateProduct(Negative, lhs, rhs);
+    return *this;
+}
+
+template<class T, class Field>
+FieldExpression<T, Field>& FieldExpression<T, Field>::AddSquare(const Element& element)
+{
+    CheckField(element, "Cannot multiply two numbers in different fields");
+    AccumulateSquare(Positive, element);
+    return *this;
+}
+
+template<class T, class Field>
+FieldExpression<T, Field>& FieldExpression<T, Field>::SubtractSquare(const Element& element)
+{
+    CheckField(element, "Cannot multiply two numbers in different fields");
+    AccumulateSquare(Negative, element);
+    return *this;
+}
+
+template<class T, class Field> FieldElement<T, Field> FieldExpression<T, Field>::Evaluate() const
+{
+    if constexpr (Accumulator::Enabled)
+        return Element::Trusted(Accumulator::Reduce(Positive, Negative, Prime), *this);
+    else
+        return Element::Trusted(SubtractModulo(Positive, Negative, Prime), *this);
+}
+
+template<class T, class Field>
+void FieldExpression<T, Field>::CheckField(const Element& element, const char* error) const
+{
+    // Elements must be in the same finite field, otherwise the calculation is meaningless
+    if constexpr (!Element::StaticPrime)
+    {
+        if (element.Prime != Prime)
+            throw std::runtime_error(error);
+    }
+}
+
+template<class T, class Field> void FieldExpression<T, Field>::Accumulate(Wide& sum, const Element& element)
+{
+    if constexpr (Accumulator::Enabled)
+        sum += Accumulator::Widen(element.Number);
+    else
+        sum = AddModulo(sum, element.Number, Prime);
+}
+
+template<class T, class Field>
+void FieldExpression<T, Field>::AccumulateProduct(Wide& sum, const Element& lhs, const Element& rhs)
+{
+    if constexpr (Accumulator::Enabled)
+        sum += Accumulator::Multiply(lhs.Number, rhs.Number);
+    else
+        sum = AddModulo(sum, MultiplyModulo(lhs.Number, rhs.Number, Prime), Prime);
+}
+
+template<class T, class Field> void FieldExpression<T, Field>::AccumulateSquare(Wide& sum, const Element& element)
+{
+    if constexpr (Accumulator::Enabled)
+        sum += Accumulator::Square(element.Number);
+    else
+        sum = AddModulo(sum, SquareModulo(element.Number, Prime), Prime);
+}
+
+} // namespace crypto
@@ -1,18 +1,223 @@
 #pragma once
 
+#include "Barrett.hpp"
+#include "Exponentiation.hpp"
+#include "Montgomery.hpp"
+#include "uint512_t.hpp"
+
+#include <exception>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
 namespace crypto
 {
 
-// Calculates (a^b) % modulus
+// Values produced by the arithmetic are valid by construction, so elements and points built from them go
+// through a trusted constructor that skips the range and curve checks; see the Trusted() factories. The
+// validating constructors are for values from outside, such as parsed input. Define CRYPTO_VALIDATE_TRUSTED
+// (scons validate=1) to run the full checks on the trusted path as well, as a debug build would.
+struct TrustedTag
+{
+};
+
+// Calculates (a + b) % modulus for a, b in [0, modulus) without overflowing T
+template<class T> T AddModulo(const T& a, const T& b, const T& modulus)
+{
+    if (a >= modulus - b)
+        return a - (modulus - b);
+    return a + b;
+}
+
+// Calculates (a - b) % modulus for a, b in [0, modulus) without going negative
+template<class T> T SubtractModulo(const T& a, const T& b, const T& modulus)
+{
+    if (a >= b)
+        return a - b;
+    return modulus - (b - a);
+}
+
+// Calculates (a * b) % modulus
+template<class T> T MultiplyModulo(const T& a, const T& b, const T& modulus)
+{
+    return (a * b) % modulus;
+}
+
+// The product of two 256-bit numbers needs 512 bits, so reduce the full width product
+inline uint256_t MultiplyModulo(const uint256_t& a, const uint256_t& b, const uint256_t& modulus)
+{
+    return mulmod(a, b, modulus);
+}
+
+// Calculates (a * a) % modulus
+template<class T> T SquareModulo(const T& a, const T& modulus)
+{
+    return (a * a) % modulus;
+}
+
+// Each cross product is computed once, which saves about a third of the limb multiplies
+inline uint256_t SquareModulo(const uint256_t& a, const uint256_t& modulus)
+{
+    return uint512_t(a.sqr_wide()) % modulus;
+}
+
+// Calculates (a^b) % modulus by right to left square and multiply
 template<class T> T PowerModulo(T a, T b, T modulus)
 {
-    if (b == 0)
-        return 1;
+    T result = 1 % modulus;
+    a = a % modulus;
+    while (b != 0)
+    {
+        if ((b & 1) != 0)
+            result = MultiplyModulo(result, a, modulus);
+        a = SquareModulo(a, modulus);
+        b = b >> 1;
+    }
+    return result;
+}
+
+// Sliding window exponentiation. Odd moduli run it in Montgomery form, even ones reduce each
+// product with a Barrett reducer, so either way only setting up the reducer divides
+inline uint256_t PowerModulo(const uint256_t& a, const uint256_t& b, const uint256_t& modulus)
+{
+    if (modulus < 2)
+        return 0;
+
+    if (!(modulus & 1))
+    {
+        const BarrettReducer reducer(modulus);
+        auto multiply = [&reducer](const uint256_t& lhs, const uint256_t& rhs) { return reducer.Multiply(lhs, rhs); };
+        auto square = [&reducer](const uint256_t& number) { return reducer.Square(number); };
+        return SlidingWindowPower(a % modulus, b, uint256_1, multiply, square);
+    }
 
-    auto p = PowerModulo(a, b / 2, modulus);
-    p = (p * p) % modulus;
+    const MontgomeryContext context(modulus);
+    return context.FromMontgomery(context.Power(context.ToMontgomery(a % modulus), b));
+}
+
+// The exponent in [0, prime - 1] that raises every element of the field to the same value as power, for
+// power of any integer type, signed or not and as wide as uint256_t. As a^(p-1) = 1, a negative power -k is
+// the same as p - 1 - k, and larger powers only matter modulo p - 1. Positive powers stay positive, so that
+// zero still comes out as zero, which also leaves powers within range untouched.
+template<class T, class E> T FieldExponent(const E& power, const T& prime)
+{
+    constexpr bool Wide256 = std::is_same<T, uint256_t>::value || std::is_same<E, uint256_t>::value;
+    typedef std::conditional_t<Wide256, uint256_t, uint64_t> Wide;
+    const Wide order = Wide(prime - 1);
+
+    Wide exponent;
+    if constexpr (std::is_signed<E>::value)
+    {
+        // -(power + 1) cannot overflow, even for the most negative power
+        if (power < 0)
+            exponent = order - 1 - Wide(-(power + 1)) % order;
+        else
+            exponent = Wide(power);
+    }
+    else
+    {
+        exponent = Wide(power);
+    }
+    if (exponent > order)
+        exponent = (exponent - 1) % order + 1;
+
+    if constexpr (std::is_same<T, Wide>::value)
+        return exponent;
+    else
+        return T(uint64_t(exponent));
+}
 
-    return (b % 2 == 0) ? p : (a * p) % modulus;
+// Calculates a^-1 % modulus with the extended Euclidean algorithm. The Bezout
+// coefficient is kept reduced modulo the modulus, so it never goes negative
+template<class T> T InverseModulo(const T& a, const T& modulus)
+{
+    T r0 = modulus, r1 = a;
+    T t0 = 0, t1 = 1;
+    while (r1 != 0)
+    {
+        const T q = r0 / r1;
+        const T r2 = r0 - q * r1;
+        const T t2 = SubtractModulo(t0, MultiplyModulo(q % modulus, t1, modulus), modulus);
+        r0 = r1;
+        r1 = r2;
+        t0 = t1;
+        t1 = t2;
+    }
+
+    if (r0 != 1)
+        throw std::runtime_error("Number has no inverse modulo the modulus");
+    return t0;
+}
+
+// Binary extended Euclid for odd moduli: only shifts, additions and subtractions, no division.
+// Keeps u == x1 * a and v == x2 * a (mod modulus) while driving one of u, v down to 1
+inline uint256_t InverseModulo(const uint256_t& a, const uint256_t& modulus)
+{
+    if (!(modulus & 1) || modulus < 3)
+        return InverseModulo<uint256_t>(a, modulus);
+    if (a == 0)
+        throw std::runtime_error("Number has no inverse modulo the modulus");
+
+    // Halves x modulo the odd modulus; (x + modulus) / 2 is formed without overflowing 256 bits
+    const uint256_t half = (modulus >> 1) + 1;
+    auto halve = [&half](uint256_t& x) { x = (x & 1) ? (x >> 1) + half : x >> 1; };
+
+    uint256_t u = a, v = modulus;
+    uint256_t x1 = 1, x2 = 0;
+    while (u != 1 && v != 1)
+    {
+        if (u == 0)
+            throw std::runtime_error("Number has no inverse modulo the modulus");
+        while (!(u & 1))
+        {
+            u >>= 1;
+            halve(x1);
+        }
+        while (!(v & 1))
+        {
+            v >>= 1;
+            halve(x2);
+        }
+        if (u >= v)
+        {
+            u -= v;
+            x1 = SubtractModulo(x1, x2, modulus);
+        }
+        else
+        {
+            v -= u;
+            x2 = SubtractModulo(x2, x1, modulus);
+        }
+    }
+    return u == 1 ? x1 : x2;
+}
+
+// The Jacobi symbol (a/n) for odd n > 0: 1 or -1 when a and n are coprime, 0 otherwise.
+// For a prime n it is the Legendre symbol, 1 exactly when a is a non-zero square mod n.
+// After the first reduction it only shifts, subtracts and swaps, using
+// (2/n) = -1 for n = 3, 5 (mod 8) and quadratic reciprocity for two odd numbers
+template<class T> int JacobiSymbol(T a, T n)
+{
+    a = a % n;
+    int result = 1;
+    while (a != 0)
+    {
+        while ((a & 1) == 0)
+        {
+            a = a >> 1;
+            const T r = n & 7;
+            if (r == 3 || r == 5)
+                result = -result;
+        }
+        if (a < n)
+        {
+            std::swap(a, n);
+            if ((a & 3) == 3 && (n & 3) == 3)
+                result = -result;
+        }
+        a = a - n;
+    }
+    return n == 1 ? result : 0;
 }
 
 } // namespace crypto
@@ -0,0 +1,163 @@
+#pragma once
+
+#include "Exponentiation.hpp"
+#include "uint256_t_limbs.hpp"
+#include "uint512_t.hpp"
+
+#include <exception>
+#include <stdexcept>
+
+namespace crypto
+{
+
+// Montgomery arithmetic modulo a fixed odd 256-bit modulus p, with R = 2^256.
+// A value a is held as a * R mod p; multiplying two such values and reducing
+// by R^-1 keeps them in that form using only limb multiplies, adds and shifts.
+// The only division is the one-off computation of R^2 mod p in the constructor.
+class MontgomeryContext
+{
+  public:
+    MontgomeryContext(const uint256_t& modulus);
+    ~MontgomeryContext() = default;
+
+    // Conversion into and out of Montgomery form
+    uint256_t ToMontgomery(const uint256_t& number) const;
+    uint256_t FromMontgomery(const uint256_t& number) const;
+
+    // Operands and results are in Montgomery form and below the modulus
+    uint256_t Multiply(const uint256_t& lhs, const uint256_t& rhs) const;
+    uint256_t Square(const uint256_t& number) const;
+    uint256_t Power(const uint256_t& base, const uint256_t& exponent) const;
+
+    uint256_t Modulus;
+    // -p^-1 mod 2^64
+    uint64_t Inverse;
+    // R mod p, the Montgomery form of 1
+    uint256_t One;
+    // R^2 mod p, converts into Montgomery form with a single multiply
+    uint256_t RSquared;
+
+  private:
+    // Reduces the 512-bit value in t (least significant limb first) to t * R^-1 mod p
+    uint256_t Reduce(uint64_t (&t)[8]) const;
+};
+
+inline MontgomeryContext::MontgomeryContext(const uint256_t& modulus)
+  : Modulus(modulus)
+  , Inverse(0)
+  , One(0)
+  , RSquared(0)
+{
+    if (!(Modulus & 1) || Modulus < 3)
+    {
+        throw std::runtime_error("Montgomery modulus must be odd and greater than 1");
+    }
+
+    // Newton iteration doubles the number of correct low bits each step; p * p == 1 mod 8 to start
+    const uint64_t low = Modulus.limb(0);
+    uint64_t inverse = low;
+    for (int i = 0; i < 5; i++)
+    {
+        inverse *= 2 - low * inverse;
+    }
+    Inverse = -inverse;
+
+    // 2^256 - p is congruent to R
+    One = (uint256_0 - Modulus) % Modulus;
+    RSquared = mulmod(One, One, Modulus);
+}
+
+inline uint256_t MontgomeryContext::ToMontgomery(const uint256_t& number) const
+{
+    return Multiply(number, RSquared);
+}
+
+inline uint256_t MontgomeryContext::FromMontgomery(const uint256_t& number) const
+{
+    uint64_t t[8] = {number.limb(0), number.limb(1), number.limb(2), number.limb(3), 0, 0, 0, 0};
+    return Reduce(t);
+}
+
+inline uint256_t MontgomeryContext::Multiply(const uint256_t& lhs, const uint256_t& rhs) const
+{
+    using uint256_limbs::dlimb_t;
+
+    // Coarsely integrated operand scanning: add lhs * rhs[i] and one multiple of p per limb,
+    // dropping the low limb (which is zero by choice of m) every round
+    uint64_t t[6] = {0, 0, 0, 0, 0, 0};
+    for (int i = 0; i < 4; i++)
+    {
+        const uint64_t b = rhs.limb(i);
+        uint64_t carry = 0;
+        for (int j = 0; j < 4; j++)
+        {
+            const dlimb_t sum = (dlimb_t)lhs.limb(j) * b + t[j] + carry;
+            t[j] = (uint64_t)sum;
+            carry = (uint64_t)(sum >> 64);
+        }
+        dlimb_t sum = (dlimb_t)t[4] + carry;
+        t[4] = (uint64_t)sum;
+        t[5] = (uint64_t)(sum >> 64);
+
+        const uint64_t m = t[0] * Inverse;
+        sum = (dlimb_t)m * Modulus.limb(0) + t[0];
+        carry = (uint64_t)(sum >> 64);
+        for (int j = 1; j < 4; j++)
+        {
+            sum = (dlimb_t)m * Modulus.limb(j) + t[j] + carry;
+            t[j - 1] = (uint64_t)sum;
+            carry = (uint64_t)(sum >> 64);
+        }
+        sum = (dlimb_t)t[4] + carry;
+        t[3] = (uint64_t)sum;
+        t[4] = t[5] + (uint64_t)(sum >> 64);
+    }
+
+    // The result is below 2p, so at most one subtraction brings it into range
+    const uint256_t out(t[3], t[2], t[1], t[0]);
+    return (t[4] || out >= Modulus) ? out - Modulus : out;
+}
+
+inline uint256_t MontgomeryContext::Square(const uint256_t& number) const
+{
+    const auto square = number.sqr_wide();
+    uint64_t t[8] = {square.second.limb(0), square.second.limb(1), square.second.limb(2), square.second.limb(3),
+                     square.first.limb(0),  square.first.limb(1),  square.first.limb(2),  square.first.limb(3)};
+    return Reduce(t);
+}
+
+inline uint256_t MontgomeryContext::Power(const uint256_t& base, const uint256_t& exponent) const
+{
+    return SlidingWindowPower(
+      base, exponent, One, [this](const uint256_t& lhs, const uint256_t& rhs) { return Multiply(lhs, rhs); },
+      [this](const uint256_t& number) { return Square(number); });
+}
+
+inline uint256_t MontgomeryContext::Reduce(uint64_t (&t)[8]) const
+{
+    using uint256_limbs::dlimb_t;
+
+    // Each round clears the lowest remaining limb by adding a multiple of p, carrying into the top
+    uint64_t overflow = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        const uint64_t m = t[i] * Inverse;
+        uint64_t carry = 0;
+        for (int j = 0; j < 4; j++)
+        {
+            const dlimb_t sum = (dlimb_t)m * Modulus.limb(j) + t[i + j] + carry;
+            t[i + j] = (uint64_t)sum;
+            carry = (uint64_t)(sum >> 64);
+        }
+        for (int j = i + 4; j < 8; j++)
+        {
+            t[j] = uint256_limbs::addc(t[j], carry, 0, carry);
+        }
+        overflow += carry;
+    }
+
+    const uint256_t out(t[7], t[6], t[5], t[4]);
+    return (overflow || out >= Modulus) ? out - Modulus : out;
+}
+
+} // namespace crypto
@@ -1,23 +1,46 @@
 #pragma once
 
+#include "FieldElement.hpp"
+#include "FieldExpression.hpp"
+
 #include <exception>
 #include <iostream>
 #include <optional>
 #include <sstream>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <variant>
 
 namespace crypto
 {
 
 // Forward declarations for template specialization
-template<class T> class FieldElement;
 template<class T> class Point;
 template<class T> std::ostream& operator<<(std::ostream& out, const Point<T>& point);
-template<class T> std::ostream& operator<<(std::ostream& out, const Point<FieldElement<T>>& point);
+template<class T, class Field>
+std::ostream& operator<<(std::ostream& out, const Point<FieldElement<T, Field>>& point);
 template<class T> Point<T> operator+(const Point<T>& lhs, const Point<T>& rhs);
-template<class T>
-Point<FieldElement<T>> operator+(const Point<FieldElement<T>>& lhs, const Point<FieldElement<T>>& rhs);
+template<class T, class Field>
+Point<FieldElement<T, Field>> operator+(const Point<FieldElement<T, Field>>& lhs,
+                                        const Point<FieldElement<T, Field>>& rhs);
+
+// Whether T has its own squaring kernel, as the field element types do
+template<class T, class = void> struct HasSquare : std::false_type
+{
+};
+template<class T> struct HasSquare<T, std::void_t<decltype(std::declval<const T&>().Square())>> : std::true_type
+{
+};
+
+// value * value, through the squaring kernel where T has one
+template<class T> T SquareOf(const T& value)
+{
+    if constexpr (HasSquare<T>::value)
+        return value.Square();
+    else
+        return value * value;
+}
 
 template<class T> class Point
 {
@@ -26,6 +49,9 @@ template<class T> class Point
     Point(std::optional<T> x, std::optional<T> y, T a, T b);
     ~Point() = default;
 
+    // A point the caller knows to be on the curve, such as the result of an addition
+    static Point Trusted(std::optional<T> x, std::optional<T> y, T a, T b);
+
     template<class U> friend bool operator==(const Point& lhs, const Point& rhs);
     template<class U> friend bool operator!=(const Point& lhs, const Point& rhs);
     template<class U> friend Point operator+(const Point& lhs, const Point& rhs);
@@ -39,6 +65,11 @@ template<class T> class Point
     T B;
 
   protected:
+    Point(TrustedTag, std::optional<T> x, std::optional<T> y, T a, T b);
+
+    // Throws unless the point is the point at infinity or lies on the curve
+    void Validate() const;
+
     template<class U> friend bool operator==(const std::optional<T>& lhs, const std::optional<T>& rhs);
     template<class U> friend bool operator!=(const std::optional<T>& lhs, const std::optional<T>& rhs);
 };
@@ -56,6 +87,28 @@ Point<T>::Point(std::optional<T> x, std::optional<T> y, T a, T b)
   , Y(y)
   , A(a)
   , B(b)
+{
+    Validate();
+}
+
+template<class T>
+Point<T>::Point(TrustedTag, std::optional<T> x, std::optional<T> y, T a, T b)
+  : X(x)
+  , Y(y)
+  , A(a)
+  , B(b)
+{
+#ifdef CRYPTO_VALIDATE_TRUSTED
+    Validate();
+#endif
+}
+
+template<class T> Point<T> Point<T>::Trusted(std::optional<T> x, std::optional<T> y, T a, T b)
+{
+    return Point(TrustedTag(), x, y, a, b);
+}
+
+template<class T> void Point<T>::Validate() const
 {
     // Avoid infinity point
     if (!X && !Y)
@@ -66,7 +119,7 @@ Point<T>::Point(std::optional<T> x, std::optional<T> y, T a, T b)
         throw std::runtime_error("X and Y values must either both be null or both non-null");
 
     // y^2 = x^3 + ax + b is the formula for the curve
-    if (Y.value() * Y.value() != X.value() * X.value() * X.value() + (A * X.value()) + B)
+    if (SquareOf(Y.value()) != SquareOf(X.value()) * X.value() + (A * X.value()) + B)
     {
         std::stringstream error;
         error << "(" << X.value() << ", " << Y.value() << ") is not on the curve";
@@ -84,6 +137,8 @@ template<class T> bool operator!=(const Point<T>& lhs, const Point<T>& rhs)
     return !(lhs == rhs);
 }
 
+// Results are validated here: over integers, such as Point<int> with its truncating division, the formulas
+// do not keep them on the curve. Only the FieldElement overload below takes the trusted path
 template<class T> Point<T> operator+(const Point<T>& lhs, const Point<T>& rhs)
 {
     // Elements must be on the same curve
@@ -109,7 +164,7 @@ template<class T> Point<T> operator+(const Point<T>& lhs, const Point<T>& rhs)
     {
         // TODO: Ensure Y values exist by overloading the subtraction operator
         auto slope = (rhs.Y.value() - lhs.Y.value()) / (rhs.X.value() - lhs.X.value());
-        auto x3 = slope * slope - lhs.X.value() - rhs.X.value();
+        auto x3 = SquareOf(slope) - lhs.X.value() - rhs.X.value();
         auto y3 = slope * (lhs.X.value() - x3) - lhs.Y.value();
         return Point<T>(x3, y3, lhs.A, lhs.B);
     }
@@ -123,10 +178,10 @@ template<class T> Point<T> operator+(const Point<T>& lhs, const Point<T>& rhs)
     if (lhs == rhs)
     {
         // TODO: Ensure values exist
-        auto slope = ((3 * lhs.X.value() * lhs.X.value()) + lhs.A) / (2 * lhs.Y.value());
-        auto x3 = slope * slope - 2 * lhs.X.value();
+        auto slope = ((3 * SquareOf(lhs.X.value())) + lhs.A) / (2 * lhs.Y.value());
+        auto x3 = SquareOf(slope) - 2 * lhs.X.value();
         auto y3 = slope * (lhs.X.value() - x3) - lhs.Y.value();
-        return Point(x3, y3, lhs.A, lhs.B);
+        return Point<T>(x3, y3, lhs.A, lhs.B);
     }
 
     // Handle this possible error condition
@@ -163,8 +218,13 @@ template<class T> bool operator!=(const std::optional<T>& lhs, const std::option
     return !(lhs == rhs);
 }
 
-template<class T> Point<FieldElement<T>> operator+(const Point<FieldElement<T>>& lhs, const Point<FieldElement<T>>& rhs)
+// Each coordinate is a single FieldExpression, so it is reduced once rather than after every operation
+template<class T, class Field>
+Point<FieldElement<T, Field>> operator+(const Point<FieldElement<T, Field>>& lhs,
+                                        const Point<FieldElement<T, Field>>& rhs)
 {
+    typedef FieldExpression<T, Field> Expression;
+
     // Elements must be on the same curve
     if (lhs.A != rhs.A || lhs.B != rhs.B)
     {
@@ -181,32 +241,33 @@ template<class T> Point<FieldElement<T>> operator+(const Point<FieldElement<T>>&
 
     // Handle vertical line
     if (lhs.X == rhs.X && lhs.Y != rhs.Y)
-        return Point<FieldElement<T>>(std::nullopt, std::nullopt, lhs.A, lhs.B);
+        return Point<FieldElement<T, Field>>::Trusted(std::nullopt, std::nullopt, lhs.A, lhs.B);
 
     // Handle X1 != X2
     if (lhs.X != rhs.X)
     {
         // TODO: Ensure Y values exist by overloading the subtraction operator
         auto slope = (rhs.Y.value() - lhs.Y.value()) / (rhs.X.value() - lhs.X.value());
-        auto x3 = slope * slope - lhs.X.value() - rhs.X.value();
-        auto y3 = slope * (lhs.X.value() - x3) - lhs.Y.value();
-        return Point<FieldElement<T>>(x3, y3, lhs.A, lhs.B);
+        auto x3 = Expression(slope).AddSquare(slope).Subtract(lhs.X.value()).Subtract(rhs.X.value()).Evaluate();
+        auto y3 = Expression(slope).AddProduct(slope, lhs.X.value() - x3).Subtract(lhs.Y.value()).Evaluate();
+        return Point<FieldElement<T, Field>>::Trusted(x3, y3, lhs.A, lhs.B);
     }
 
     // Handle special case of vertical tangent line.
     // TODO: Book has this in Python as `if self == other and self.y == 0 * self.x:`
     if (lhs == rhs && lhs.Y.value().Number == 0)
-        return Point<FieldElement<T>>(std::nullopt, std::nullopt, lhs.A, lhs.B);
+        return Point<FieldElement<T, Field>>::Trusted(std::nullopt, std::nullopt, lhs.A, lhs.B);
 
     // Handle P1 = P2
     if (lhs == rhs)
     {
         // TODO: Ensure values exist
-        auto slope = ((FieldElement<T>(3, lhs.A.Prime) * lhs.X.value() * lhs.X.value()) + lhs.A) /
-                     (FieldElement<T>(2, lhs.A.Prime) * lhs.Y.value());
-        auto x3 = (slope * slope) - (FieldElement<T>(2, lhs.A.Prime) * lhs.X.value());
-        auto y3 = slope * (lhs.X.value() - x3) - lhs.Y.value();
-        return Point<FieldElement<T>>(x3, y3, lhs.A, lhs.B);
+        auto square = lhs.X.value().Square();
+        auto slope = Expression(lhs.A).Add(square).Add(square).Add(square).Add(lhs.A).Evaluate() /
+                     Expression(lhs.A).Add(lhs.Y.value()).Add(lhs.Y.value()).Evaluate();
+        auto x3 = Expression(slope).AddSquare(slope).Subtract(lhs.X.value()).Subtract(lhs.X.value()).Evaluate();
+        auto y3 = Expression(slope).AddProduct(slope, lhs.X.value() - x3).Subtract(lhs.Y.value()).Evaluate();
+        return Point<FieldElement<T, Field>>::Trusted(x3, y3, lhs.A, lhs.B);
     }
 
     // Handle this possible error condition
@@ -215,7 +276,8 @@ template<class T> Point<FieldElement<T>> operator+(const Point<FieldElement<T>>&
     throw std::runtime_error(error.str());
 }
 
-template<class T> std::ostream& operator<<(std::ostream& os, const Point<FieldElement<T>>& point)
+template<class T, class Field>
+std::ostream& operator<<(std::ostream& os, const Point<FieldElement<T, Field>>& point)
 {
     if (!point.X)
         os << "Point(infinity)";
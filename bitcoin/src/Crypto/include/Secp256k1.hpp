@@ -0,0 +1,314 @@
+#pragma once
+
+#include "Exponentiation.hpp"
+#include "Helpers.hpp"
+#include "uint256_t.hpp"
+#include "uint256_t_limbs.hpp"
+
+#include <exception>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+namespace crypto
+{
+
+// Arithmetic modulo the secp256k1 field prime p = 2^256 - 2^32 - 977. Because
+// 2^256 == 2^32 + 977 (mod p), the high half of a product folds back into the
+// low half with one small multiply per limb, so nothing here ever divides.
+// Operands and results are fully reduced, in [0, p).
+class Secp256k1Field
+{
+  public:
+    static constexpr uint256_t Prime = 0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f_u256;
+    // 2^256 - p
+    static constexpr uint64_t C = 0x1000003d1ULL;
+
+    static uint256_t Add(const uint256_t& lhs, const uint256_t& rhs);
+    static uint256_t Subtract(const uint256_t& lhs, const uint256_t& rhs);
+    static uint256_t Multiply(const uint256_t& lhs, const uint256_t& rhs);
+    static uint256_t Square(const uint256_t& number);
+    static uint256_t Power(const uint256_t& base, const uint256_t& exponent);
+
+    // Fixed addition chains for the two exponents every curve operation needs:
+    // a^(p-2), the inverse by Fermat, and a^((p+1)/4), a square root when one exists.
+    // Each takes at most 255 squarings and 15 multiplications
+    static uint256_t Inverse(const uint256_t& number);
+    static uint256_t PowerSqrt(const uint256_t& number);
+
+  private:
+    // (a^(2^223 - 1))^(2^23) * a^(2^22 - 1), the start shared by both chains. Also leaves a^3 in x2
+    static uint256_t ChainPrefix(const uint256_t& number, uint256_t& x2);
+    // number^(2^count)
+    static uint256_t SquareTimes(uint256_t number, const int count);
+    // Reduces the 512-bit value in t (least significant limb first) modulo p
+    static uint256_t Reduce(const uint64_t (&t)[8]);
+};
+
+inline uint256_t Secp256k1Field::Add(const uint256_t& lhs, const uint256_t& rhs)
+{
+    // The sum is below 2p. When it wraps, the lost 2^256 is worth C and the result is already below p
+    const uint256_t sum = lhs + rhs;
+    if (sum < lhs)
+        return sum + C;
+    return sum >= Prime ? sum - Prime : sum;
+}
+
+inline uint256_t Secp256k1Field::Subtract(const uint256_t& lhs, const uint256_t& rhs)
+{
+    // Adding p to the wrapped difference is the same as taking C away from it
+    const uint256_t difference = lhs - rhs;
+    return lhs < rhs ? difference - C : difference;
+}
+
+inline uint256_t Secp256k1Field::Multiply(const uint256_t& lhs, const uint256_t& rhs)
+{
+    const auto product = lhs.mul_wide(rhs);
+    const uint256_t& low = product.second;
+    const uint256_t& high = product.first;
+    const uint64_t t[8] = {low.limb(0),  low.limb(1),  low.limb(2),  low.limb(3),
+                           high.limb(0), high.limb(1), high.limb(2), high.limb(3)};
+    return Reduce(t);
+}
+
+inline uint256_t Secp256k1Field::Square(const uint256_t& number)
+{
+    const auto square = number.sqr_wide();
+    uint64_t t[8] = {square.second.limb(0), square.second.limb(1), square.second.limb(2), square.second.limb(3),
+                     square.first.limb(0),  square.first.limb(1),  square.first.limb(2),  square.first.limb(3)};
+    return Reduce(t);
+}
+
+inline uint256_t Secp256k1Field::Power(const uint256_t& base, const uint256_t& exponent)
+{
+    return SlidingWindowPower(base, exponent, uint256_1, Multiply, Square);
+}
+
+inline uint256_t Secp256k1Field::Inverse(const uint256_t& number)
+{
+    // p - 2 ends in ...1 0000 1 0 11 0 1 after the shared prefix
+    uint256_t x2;
+    uint256_t t = ChainPrefix(number, x2);
+    t = Multiply(SquareTimes(t, 5), number);
+    t = Multiply(SquareTimes(t, 3), x2);
+    return Multiply(SquareTimes(t, 2), number);
+}
+
+inline uint256_t Secp256k1Field::PowerSqrt(const uint256_t& number)
+{
+    // (p + 1) / 4 ends in ...0 000 11 00 after the shared prefix
+    uint256_t x2;
+    uint256_t t = ChainPrefix(number, x2);
+    t = Multiply(SquareTimes(t, 6), x2);
+    return SquareTimes(t, 2);
+}
+
+inline uint256_t Secp256k1Field::ChainPrefix(const uint256_t& number, uint256_t& x2)
+{
+    // xn = number^(2^n - 1), each built from two shorter runs of ones
+    x2 = Multiply(Square(number), number);
+    const uint256_t x3 = Multiply(Square(x2), number);
+    const uint256_t x6 = Multiply(SquareTimes(x3, 3), x3);
+    const uint256_t x9 = Multiply(SquareTimes(x6, 3), x3);
+    const uint256_t x11 = Multiply(SquareTimes(x9, 2), x2);
+    const uint256_t x22 = Multiply(SquareTimes(x11, 11), x11);
+    const uint256_t x44 = Multiply(SquareTimes(x22, 22), x22);
+    const uint256_t x88 = Multiply(SquareTimes(x44, 44), x44);
+    const uint256_t x176 = Multiply(SquareTimes(x88, 88), x88);
+    const uint256_t x220 = Multiply(SquareTimes(x176, 44), x44);
+    const uint256_t x223 = Multiply(SquareTimes(x220, 3), x3);
+    return Multiply(SquareTimes(x223, 23), x22);
+}
+
+inline uint256_t Secp256k1Field::SquareTimes(uint256_t number, const int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        number = Square(number);
+    }
+    return number;
+}
+
+inline uint256_t Secp256k1Field::Reduce(const uint64_t (&t)[8])
+{
+    // First fold: low + high * C, which needs at most 290 bits
+    uint64_t r[5] = {t[0], t[1], t[2], t[3], 0};
+    uint64_t carry = 0, high = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        uint64_t c = 0;
+        uint64_t next = 0;
+        const uint64_t low = uint256_limbs::addc(uint256_limbs::mul(t[i + 4], C, next), high, 0, c);
+        high = next + c;
+        r[i] = uint256_limbs::addc(r[i], low, carry, carry);
+    }
+    r[4] = high + carry;
+
+    // Second fold: the top limb is below 2^35, so r[4] * C fits in two limbs
+    uint64_t top = 0;
+    const uint64_t low = uint256_limbs::mul(r[4], C, top);
+    r[0] = uint256_limbs::addc(r[0], low, 0, carry);
+    r[1] = uint256_limbs::addc(r[1], top, carry, carry);
+    r[2] = uint256_limbs::addc(r[2], 0, carry, carry);
+    r[3] = uint256_limbs::addc(r[3], 0, carry, carry);
+
+    // A final carry leaves only a small value behind, so adding C for it cannot carry again
+    uint256_t out(r[3], r[2], r[1], r[0]);
+    if (carry)
+        out += C;
+    return out >= Prime ? out - Prime : out;
+}
+
+// An element of the secp256k1 base field. It offers the same operator set as
+// FieldElement, so Point can be instantiated over it, but every operation goes
+// through the specialized reduction above instead of a generic division.
+class Secp256k1FieldElement
+{
+  public:
+    Secp256k1FieldElement(const uint256_t& number);
+    ~Secp256k1FieldElement() = default;
+
+    // From a number the caller knows to be in [0, Prime)
+    static Secp256k1FieldElement Trusted(const uint256_t& number);
+
+    Secp256k1FieldElement Square() const;
+    // Multiplicative inverse, throws for zero
+    Secp256k1FieldElement Inverse() const;
+    // Whether the element has a square root, which zero does
+    bool IsSquare() const;
+    // A square root, throws if there is none. The other root is its negation
+    Secp256k1FieldElement Sqrt() const;
+
+    static constexpr uint256_t Prime = Secp256k1Field::Prime;
+
+    uint256_t Number;
+
+  private:
+    Secp256k1FieldElement(TrustedTag, const uint256_t& number);
+
+    void CheckRange() const;
+};
+
+inline Secp256k1FieldElement::Secp256k1FieldElement(const uint256_t& number)
+  : Number(number)
+{
+    CheckRange();
+}
+
+inline Secp256k1FieldElement::Secp256k1FieldElement(TrustedTag, const uint256_t& number)
+  : Number(number)
+{
+#ifdef CRYPTO_VALIDATE_TRUSTED
+    CheckRange();
+#endif
+}
+
+inline Secp256k1FieldElement Secp256k1FieldElement::Trusted(const uint256_t& number)
+{
+    return Secp256k1FieldElement(TrustedTag(), number);
+}
+
+inline void Secp256k1FieldElement::CheckRange() const
+{
+    // Valid between 0 and P-1
+    if (Number >= Prime)
+    {
+        std::stringstream error;
+        error << "Number " << Number << " not in field range [0," << Prime - 1 << "].";
+        throw std::runtime_error(error.str());
+    }
+}
+
+inline Secp256k1FieldElement Secp256k1FieldElement::Square() const
+{
+    return Secp256k1FieldElement::Trusted(Secp256k1Field::Square(Number));
+}
+
+inline Secp256k1FieldElement Secp256k1FieldElement::Inverse() const
+{
+    if (Number == 0)
+        throw std::runtime_error("Number has no inverse modulo the modulus");
+    return Secp256k1FieldElement::Trusted(Secp256k1Field::Inverse(Number));
+}
+
+inline bool Secp256k1FieldElement::IsSquare() const
+{
+    return JacobiSymbol(Number, Prime) >= 0;
+}
+
+inline Secp256k1FieldElement Secp256k1FieldElement::Sqrt() const
+{
+    // p = 3 (mod 4), so a^((p+1)/4) is a root whenever there is one; squaring it back tells
+    const uint256_t root = Secp256k1Field::PowerSqrt(Number);
+    if (Secp256k1Field::Square(root) != Number)
+    {
+        std::stringstream error;
+        error << "Number " << Number << " has no square root modulo " << Prime << ".";
+        throw std::runtime_error(error.str());
+    }
+    return Secp256k1FieldElement::Trusted(root);
+}
+
+inline bool operator==(const Secp256k1FieldElement& lhs, const Secp256k1FieldElement& rhs)
+{
+    return lhs.Number == rhs.Number;
+}
+
+inline bool operator!=(const Secp256k1FieldElement& lhs, const Secp256k1FieldElement& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// Comparison against a plain integer, as in `y == 0`
+inline bool operator==(const Secp256k1FieldElement& lhs, const uint256_t& rhs)
+{
+    return lhs.Number == rhs;
+}
+
+inline bool operator!=(const Secp256k1FieldElement& lhs, const uint256_t& rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline Secp256k1FieldElement operator+(const Secp256k1FieldElement& lhs, const Secp256k1FieldElement& rhs)
+{
+    return Secp256k1FieldElement::Trusted(Secp256k1Field::Add(lhs.Number, rhs.Number));
+}
+
+inline Secp256k1FieldElement operator-(const Secp256k1FieldElement& lhs, const Secp256k1FieldElement& rhs)
+{
+    return Secp256k1FieldElement::Trusted(Secp256k1Field::Subtract(lhs.Number, rhs.Number));
+}
+
+inline Secp256k1FieldElement operator*(const Secp256k1FieldElement& lhs, const Secp256k1FieldElement& rhs)
+{
+    return Secp256k1FieldElement::Trusted(Secp256k1Field::Multiply(lhs.Number, rhs.Number));
+}
+
+// Multiplication by a plain integer, as in `3 * x`
+inline Secp256k1FieldElement operator*(const uint256_t& lhs, const Secp256k1FieldElement& rhs)
+{
+    return Secp256k1FieldElement::Trusted(Secp256k1Field::Multiply(lhs % Secp256k1Field::Prime, rhs.Number));
+}
+
+// Note: Bitwise XOR is commandeered for the power operator, for any integer power up to uint256_t
+template<class E, class = std::enable_if_t<std::is_integral<E>::value>>
+Secp256k1FieldElement operator^(const Secp256k1FieldElement& lhs, const E& power)
+{
+    const uint256_t exponent = FieldExponent(power, Secp256k1Field::Prime);
+    return Secp256k1FieldElement::Trusted(Secp256k1Field::Power(lhs.Number, exponent));
+}
+
+inline Secp256k1FieldElement operator/(const Secp256k1FieldElement& lhs, const Secp256k1FieldElement& rhs)
+{
+    return Secp256k1FieldElement::Trusted(Secp256k1Field::Multiply(lhs.Number, rhs.Inverse().Number));
+}
+
+inline std::ostream& operator<<(std::ostream& os, const Secp256k1FieldElement& element)
+{
+    os << "Secp256k1FieldElement(" << element.Number << ")";
+    return os;
+}
+
+} // namespace crypto
@@ -0,0 +1,297 @@
+#pragma once
+
+#include "Secp256k1.hpp"
+#include "uint256_t.hpp"
+#include "uint256_t_limbs.hpp"
+
+#include <exception>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+namespace crypto
+{
+
+// An element of the secp256k1 base field held as five 52-bit limbs in 64-bit
+// words, least significant first, following the representation used by
+// libsecp256k1. The 12 spare bits in each word let additions and negations run
+// limb by limb with no carries and no reduction. The magnitude bounds how far the
+// limbs have grown: limbs 0-3 stay below 2 * Magnitude * 2^52 and limb 4 below
+// 2 * Magnitude * 2^48. Multiplication accepts magnitudes up to 8 and always
+// produces magnitude 1; additions that would go past 8 reduce their result
+// first. The value is only brought into [0, p) when it is compared or printed.
+class Secp256k1FieldElement52
+{
+  public:
+    Secp256k1FieldElement52(const uint256_t& number);
+    ~Secp256k1FieldElement52() = default;
+
+    // The fully reduced value
+    uint256_t ToNumber() const;
+    Secp256k1FieldElement52 Square() const;
+    // Multiplicative inverse, throws for zero
+    Secp256k1FieldElement52 Inverse() const;
+
+    static constexpr uint256_t Prime = Secp256k1Field::Prime;
+    static constexpr int MaxMagnitude = 8;
+
+    uint64_t Limbs[5];
+    int Magnitude;
+
+  private:
+    Secp256k1FieldElement52(const uint64_t (&limbs)[5], const int magnitude);
+
+    static constexpr uint64_t M52 = 0xfffffffffffffULL;
+    static constexpr uint64_t M48 = 0xffffffffffffULL;
+    // 2^256 - p, and the same value weighted by 2^260 / 2^256 to fold a sixth limb
+    static constexpr uint64_t C = Secp256k1Field::C;
+    static constexpr uint64_t R = Secp256k1Field::C << 4;
+
+    // Carries the limbs down to 52 bits (48 at the top), folding the bits above 2^256
+    // back in. The value stays congruent and may still be at or just above p.
+    static void Carry(uint64_t (&t)[5]);
+    // Reduces the 10-column product c (column i weighted by 2^(52 i)) to magnitude 1
+    static Secp256k1FieldElement52 Reduce(uint256_limbs::dlimb_t (&c)[9]);
+
+    friend Secp256k1FieldElement52 operator+(const Secp256k1FieldElement52& lhs, const Secp256k1FieldElement52& rhs);
+    friend Secp256k1FieldElement52 operator-(const Secp256k1FieldElement52& lhs, const Secp256k1FieldElement52& rhs);
+    friend Secp256k1FieldElement52 operator*(const Secp256k1FieldElement52& lhs, const Secp256k1FieldElement52& rhs);
+};
+
+inline Secp256k1FieldElement52::Secp256k1FieldElement52(const uint256_t& number)
+  : Limbs{0, 0, 0, 0, 0}
+  , Magnitude(1)
+{
+    // Valid between 0 and P-1
+    if (number >= Prime)
+    {
+        std::stringstream error;
+        error << "Number " << number << " not in field range [0," << Prime - 1 << "].";
+        throw std::runtime_error(error.str());
+    }
+
+    const uint64_t l0 = number.limb(0), l1 = number.limb(1), l2 = number.limb(2), l3 = number.limb(3);
+    Limbs[0] = l0 & M52;
+    Limbs[1] = ((l0 >> 52) | (l1 << 12)) & M52;
+    Limbs[2] = ((l1 >> 40) | (l2 << 24)) & M52;
+    Limbs[3] = ((l2 >> 28) | (l3 << 36)) & M52;
+    Limbs[4] = l3 >> 16;
+}
+
+inline Secp256k1FieldElement52::Secp256k1FieldElement52(const uint64_t (&limbs)[5], const int magnitude)
+  : Limbs{limbs[0], limbs[1], limbs[2], limbs[3], limbs[4]}
+  , Magnitude(magnitude)
+{
+}
+
+inline uint256_t Secp256k1FieldElement52::ToNumber() const
+{
+    uint64_t t[5] = {Limbs[0], Limbs[1], Limbs[2], Limbs[3], Limbs[4]};
+    Carry(t);
+
+    // The limbs are now exact, so the value fits in 256 bits and is below 2p
+    const uint256_t number((t[3] >> 36) | (t[4] << 16), (t[2] >> 24) | (t[3] << 28), (t[1] >> 12) | (t[2] << 40),
+                           t[0] | (t[1] << 52));
+    return number >= Prime ? number - Prime : number;
+}
+
+inline Secp256k1FieldElement52 Secp256k1FieldElement52::Square() const
+{
+    using uint256_limbs::dlimb_t;
+
+    const uint64_t* t = Limbs;
+
+    // Cross products appear twice, so double one factor instead of multiplying twice
+    dlimb_t c[9] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+    for (int i = 0; i < 5; i++)
+    {
+        c[2 * i] += (dlimb_t)t[i] * t[i];
+        for (int j = i + 1; j < 5; j++)
+        {
+            c[i + j] += (dlimb_t)(t[i] * 2) * t[j];
+        }
+    }
+    return Reduce(c);
+}
+
+inline Secp256k1FieldElement52 Secp256k1FieldElement52::Inverse() const
+{
+    return Secp256k1FieldElement52(InverseModulo(ToNumber(), Prime));
+}
+
+inline void Secp256k1FieldElement52::Carry(uint64_t (&t)[5])
+{
+    // Propagate the carries upwards, then fold whatever sits above bit 48 of the top limb back onto
+    // the bottom one. Each fold is far smaller than the last, so this stops after a pass or two
+    uint64_t x = 0;
+    do
+    {
+        t[0] += x * C;
+        t[1] += t[0] >> 52;
+        t[0] &= M52;
+        t[2] += t[1] >> 52;
+        t[1] &= M52;
+        t[3] += t[2] >> 52;
+        t[2] &= M52;
+        t[4] += t[3] >> 52;
+        t[3] &= M52;
+        x = t[4] >> 48;
+        t[4] &= M48;
+    } while (x);
+}
+
+inline Secp256k1FieldElement52 Secp256k1FieldElement52::Reduce(uint256_limbs::dlimb_t (&c)[9])
+{
+    using uint256_limbs::dlimb_t;
+
+    // Carry the columns into 52-bit limbs so that the upper five can be multiplied by R within 128 bits
+    uint64_t d[10] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+    dlimb_t carry = 0;
+    for (int i = 0; i < 9; i++)
+    {
+        carry += c[i];
+        d[i] = (uint64_t)carry & M52;
+        carry >>= 52;
+    }
+    d[9] = (uint64_t)carry;
+
+    // 2^260 == R (mod p), so limb i + 5 folds onto limb i
+    uint64_t r[5] = {0, 0, 0, 0, 0};
+    carry = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        carry += (dlimb_t)d[i + 5] * R + d[i];
+        r[i] = (uint64_t)carry & M52;
+        carry >>= 52;
+    }
+    carry += (dlimb_t)d[9] * R + d[4];
+    r[4] = (uint64_t)carry & M48;
+    carry >>= 48;
+
+    // 2^256 == C (mod p) for what spilled past the top limb
+    carry = carry * C + r[0];
+    r[0] = (uint64_t)carry & M52;
+    carry >>= 52;
+    for (int i = 1; i < 4; i++)
+    {
+        carry += r[i];
+        r[i] = (uint64_t)carry & M52;
+        carry >>= 52;
+    }
+    r[4] += (uint64_t)carry;
+
+    return Secp256k1FieldElement52(r, 1);
+}
+
+inline bool operator==(const Secp256k1FieldElement52& lhs, const Secp256k1FieldElement52& rhs)
+{
+    return lhs.ToNumber() == rhs.ToNumber();
+}
+
+inline bool operator!=(const Secp256k1FieldElement52& lhs, const Secp256k1FieldElement52& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// Comparison against a plain integer, as in `y == 0`
+inline bool operator==(const Secp256k1FieldElement52& lhs, const uint256_t& rhs)
+{
+    return lhs.ToNumber() == rhs;
+}
+
+inline bool operator!=(const Secp256k1FieldElement52& lhs, const uint256_t& rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline Secp256k1FieldElement52 operator+(const Secp256k1FieldElement52& lhs, const Secp256k1FieldElement52& rhs)
+{
+    // Limb by limb, with no carries
+    uint64_t t[5] = {0, 0, 0, 0, 0};
+    for (int i = 0; i < 5; i++)
+    {
+        t[i] = lhs.Limbs[i] + rhs.Limbs[i];
+    }
+    const int magnitude = lhs.Magnitude + rhs.Magnitude;
+    if (magnitude > Secp256k1FieldElement52::MaxMagnitude)
+    {
+        Secp256k1FieldElement52::Carry(t);
+        return Secp256k1FieldElement52(t, 1);
+    }
+    return Secp256k1FieldElement52(t, magnitude);
+}
+
+inline Secp256k1FieldElement52 operator-(const Secp256k1FieldElement52& lhs, const Secp256k1FieldElement52& rhs)
+{
+    // Subtract from 2 * (m + 1) * p, whose limbs are each at least as large as those of a magnitude m value
+    const uint64_t k = 2 * (rhs.Magnitude + 1);
+    const uint64_t p[5] = {0xffffefffffc2fULL, 0xfffffffffffffULL, 0xfffffffffffffULL, 0xfffffffffffffULL,
+                           0xffffffffffffULL};
+    uint64_t t[5] = {0, 0, 0, 0, 0};
+    for (int i = 0; i < 5; i++)
+    {
+        t[i] = lhs.Limbs[i] + (k * p[i] - rhs.Limbs[i]);
+    }
+    const int magnitude = lhs.Magnitude + rhs.Magnitude + 1;
+    if (magnitude > Secp256k1FieldElement52::MaxMagnitude)
+    {
+        Secp256k1FieldElement52::Carry(t);
+        return Secp256k1FieldElement52(t, 1);
+    }
+    return Secp256k1FieldElement52(t, magnitude);
+}
+
+inline Secp256k1FieldElement52 operator*(const Secp256k1FieldElement52& lhs, const Secp256k1FieldElement52& rhs)
+{
+    using uint256_limbs::dlimb_t;
+
+    // Limbs below 2^56 keep each column of five products under 2^115
+    dlimb_t c[9] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+    for (int i = 0; i < 5; i++)
+    {
+        for (int j = 0; j < 5; j++)
+        {
+            c[i + j] += (dlimb_t)lhs.Limbs[i] * rhs.Limbs[j];
+        }
+    }
+    return Secp256k1FieldElement52::Reduce(c);
+}
+
+// Multiplication by a plain integer, as in `3 * x`
+inline Secp256k1FieldElement52 operator*(const uint256_t& lhs, const Secp256k1FieldElement52& rhs)
+{
+    return Secp256k1FieldElement52(lhs % Secp256k1FieldElement52::Prime) * rhs;
+}
+
+// Note: Bitwise XOR is commandeered for the power operator, for any integer power up to uint256_t
+template<class E, class = std::enable_if_t<std::is_integral<E>::value>>
+Secp256k1FieldElement52 operator^(const Secp256k1FieldElement52& lhs, const E& power)
+{
+    const uint256_t exponent = FieldExponent(power, uint256_t(Secp256k1FieldElement52::Prime));
+
+    // Left to right square and multiply over the exponent bits
+    auto result = Secp256k1FieldElement52(1);
+    for (int bit = (int)exponent.bits() - 1; bit >= 0; bit--)
+    {
+        result = result.Square();
+        if (exponent.test_bit(bit))
+        {
+            result = result * lhs;
+        }
+    }
+    return result;
+}
+
+inline Secp256k1FieldElement52 operator/(const Secp256k1FieldElement52& lhs, const Secp256k1FieldElement52& rhs)
+{
+    return lhs * rhs.Inverse();
+}
+
+inline std::ostream& operator<<(std::ostream& os, const Secp256k1FieldElement52& element)
+{
+    os << "Secp256k1FieldElement52(" << element.ToNumber() << ")";
+    return os;
+}
+
+} // namespace crypto
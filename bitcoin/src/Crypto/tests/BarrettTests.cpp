@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+
+#include "Barrett.hpp"
+#include "Helpers.hpp"
+
+using namespace crypto;
+
+namespace
+{
+const uint256_t P("fffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f", 16);
+const uint256_t N("fffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364141", 16);
+const uint256_t A("79be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798", 16);
+const uint256_t B("483ada7726a3c4655da4fbfc0e1108a8fd17b448a68554199c47d08ffb10d4b8", 16);
+} // namespace
+
+TEST(BarrettTests, ConstructorTest)
+{
+    ASSERT_THROW(BarrettReducer(uint256_t(1)), std::runtime_error);
+    ASSERT_THROW(BarrettReducer(uint256_t(0)), std::runtime_error);
+    ASSERT_NO_THROW(BarrettReducer(uint256_t(2)));
+}
+
+TEST(BarrettTests, MultiplyTest)
+{
+    // Odd and even moduli of every limb count, including powers of two
+    const uint256_t moduli[] = {P, N, uint256_t(223), uint256_t(1) << 64, uint256_t(1, 0) - 2, uint256_t(1) << 255,
+                                uint256_max, A, B >> 100};
+    for (const auto& modulus : moduli)
+    {
+        auto reducer = BarrettReducer(modulus);
+        auto a = A % modulus;
+        auto b = B % modulus;
+        for (int i = 0; i < 64; i++)
+        {
+            ASSERT_EQ(reducer.Multiply(a, b), mulmod(a, b, modulus));
+            ASSERT_EQ(reducer.Square(a), mulmod(a, a, modulus));
+
+            a = AddModulo(mulmod(a, b, modulus), uint256_1, modulus);
+            b = (b + a) % modulus;
+        }
+        ASSERT_EQ(reducer.Multiply(modulus - 1, modulus - 1), mulmod(modulus - 1, modulus - 1, modulus));
+        ASSERT_EQ(reducer.Multiply(0, modulus - 1), 0);
+    }
+}
+
+TEST(BarrettTests, ReduceTest)
+{
+    // Inputs wider than the square of a small modulus fall back to division
+    for (const auto& modulus : {P, uint256_t(223), uint256_t(1, 0) + 1})
+    {
+        auto reducer = BarrettReducer(modulus);
+        for (const auto& number :
+             {uint512_t(uint256_0), uint512_t(A), uint512_t(A, B), uint512_t(uint256_max, uint256_max)})
+        {
+            ASSERT_EQ(reducer.Reduce(number), number % modulus);
+        }
+    }
+}
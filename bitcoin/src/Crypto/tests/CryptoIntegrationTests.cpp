@@ -72,6 +72,26 @@ TEST(IntegrationTests, PointAdditionTests)
     ASSERT_EQ(p3.B.Prime, prime);
 }
 
+namespace
+{
+struct F223
+{
+    static constexpr int Prime = 223;
+};
+} // namespace
+
+TEST(IntegrationTests, StaticPrimePointAdditionTests)
+{
+    using F = FieldElement<int, F223>;
+
+    auto p1 = Point<F>(F(192), F(105), F(0), F(7));
+    auto p2 = Point<F>(F(17), F(56), F(0), F(7));
+    auto p3 = p1 + p2;
+
+    ASSERT_EQ(p3, Point<F>(F(170), F(142), F(0), F(7)));
+    ASSERT_EQ(p1 + p1, Point<F>(F(49), F(71), F(0), F(7)));
+}
+
 TEST(IntegrationTests, PointAddition2Tests)
 {
     // tests the following additions on curve y^2=x^3-7 over F_223:
@@ -212,3 +232,29 @@ TEST(IntegrationTests, PointAdditionUint256tTests)
     ASSERT_EQ(p3.B.Number, 7);
     ASSERT_EQ(p3.B.Prime, prime);
 }
+
+TEST(IntegrationTests, Secp256k1NativeUint256tTests)
+{
+    // secp256k1: y^2 = x^3 + 7 over a 256-bit prime field, without an arbitrary precision fallback
+    const ::uint256_t prime("0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f");
+    auto a = FieldElement<::uint256_t>(0, prime);
+    auto b = FieldElement<::uint256_t>(7, prime);
+    auto x = FieldElement<::uint256_t>(
+        ::uint256_t("0x79be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798"), prime);
+    auto y = FieldElement<::uint256_t>(
+        ::uint256_t("0x483ada7726a3c4655da4fbfc0e1108a8fd17b448a68554199c47d08ffb10d4b8"), prime);
+    auto generator = Point<FieldElement<::uint256_t>>(x, y, a, b);
+
+    auto doubled = generator + generator;
+    ASSERT_EQ(doubled.X.value().Number,
+              ::uint256_t("0xc6047f9441ed7d6d3045406e95c07cd85c778e4b8cef3ca7abac09b95c709ee5"));
+    ASSERT_EQ(doubled.Y.value().Number,
+              ::uint256_t("0x1ae168fea63dc339a3c58419466ceaeef7f632653266d0e1236431a950cfe52a"));
+
+    // P + 2P exercises the X1 != X2 path
+    auto tripled = generator + doubled;
+    ASSERT_EQ(tripled.X.value().Number,
+              ::uint256_t("0xf9308a019258c31049344f85f89d5229b531c845836f99b08601f113bce036f9"));
+    ASSERT_EQ(tripled.Y.value().Number,
+              ::uint256_t("0x388f7b0f632de8140fe337e62a37f3566500a99934c2231b6cb9fd7584b8e672"));
+}
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include "FieldElement.hpp"
+#include "FieldExpression.hpp"
 
 using namespace crypto;
 
@@ -45,6 +46,20 @@ TEST(FieldElementTests, MultiplyTest)
     auto a = FieldElement(24, 31);
     auto b = FieldElement(19, 31);
     ASSERT_EQ(a * b, FieldElement(22, 31));
+
+    // Squares agree with the product
+    for (int i = 0; i < 31; i++)
+    {
+        ASSERT_EQ(FieldElement(i, 31).Square(), FieldElement(i, 31) * FieldElement(i, 31));
+    }
+    const uint256_t prime("fffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f", 16);
+    for (const uint256_t& number : {uint256_0, prime - 1, prime >> 1, uint256_t(0xffffffffffffffffULL)})
+    {
+        auto c = FieldElement<uint256_t>(number, prime);
+        auto d = FieldElement<uint256_t>(number, prime);
+        ASSERT_EQ(c.Square().Number, mulmod(number, number, prime));
+        ASSERT_EQ(c * c, c * d);
+    }
 }
 
 TEST(FieldElementTests, PowerTest)
@@ -58,6 +73,24 @@ TEST(FieldElementTests, PowerTest)
 
     auto d = FieldElement(17, 31);
     ASSERT_EQ(d ^ 300000, FieldElement(1, 31));
+
+    // Powers of any integer type, reduced modulo p - 1 in one step
+    ASSERT_EQ(d ^ 3000000000u, d ^ (3000000000u % 30));
+    ASSERT_EQ(d ^ INT64_MIN, d ^ -8);
+    ASSERT_EQ(d ^ INT32_MIN, d ^ -8);
+    ASSERT_EQ(d ^ uint256_max, d ^ 15);
+    ASSERT_EQ(FieldElement(0, 31) ^ 60, FieldElement(0, 31));
+    ASSERT_EQ(FieldElement(0, 31) ^ 0, FieldElement(1, 31));
+
+    // Full width exponents on 256-bit fields
+    const uint256_t prime("fffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f", 16);
+    auto e = FieldElement<uint256_t>(
+        uint256_t("79be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798", 16), prime);
+    ASSERT_EQ(e ^ (prime - 2), e.Inverse());
+    ASSERT_EQ(e ^ -1, e.Inverse());
+    ASSERT_EQ(e ^ (prime - 1), FieldElement<uint256_t>(1, prime));
+    ASSERT_EQ((e ^ -2) * (e ^ 2), FieldElement<uint256_t>(1, prime));
+    ASSERT_EQ(e ^ uint256_max, e ^ (uint256_max % (prime - 1)));
 }
 
 TEST(FieldElementTests, DivisionTest)
@@ -74,6 +107,186 @@ TEST(FieldElementTests, DivisionTest)
     ASSERT_EQ((d ^ -4) * e, FieldElement(13, 31));
 }
 
+TEST(FieldElementTests, InverseTest)
+{
+    for (int i = 1; i < 31; i++)
+    {
+        auto a = FieldElement(i, 31);
+        ASSERT_EQ(a * a.Inverse(), FieldElement(1, 31));
+    }
+    ASSERT_THROW(FieldElement(0, 31).Inverse(), std::runtime_error);
+
+    // Binary extended Euclid for odd uint256_t moduli, the Euclidean algorithm otherwise
+    const uint256_t prime("fffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f", 16);
+    const uint256_t number("79be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798", 16);
+    auto b = FieldElement<uint256_t>(number, prime);
+    ASSERT_EQ(b.Inverse().Number, PowerModulo(number, prime - 2, prime));
+    ASSERT_EQ((b * b.Inverse()).Number, 1);
+    ASSERT_EQ(FieldElement<uint256_t>(prime - 1, prime).Inverse().Number, prime - 1);
+    ASSERT_EQ(InverseModulo(uint256_t(3), uint256_t(1) << 255), ((uint256_t(1) << 255) + 1) / 3);
+    ASSERT_THROW(InverseModulo(uint256_t(6), uint256_t(9)), std::runtime_error);
+    ASSERT_THROW(InverseModulo(uint256_t(6), uint256_t(8)), std::runtime_error);
+}
+
+TEST(FieldElementTests, BatchInvertTest)
+{
+    std::vector<FieldElement<int>> elements;
+    for (int i = 0; i < 31; i++)
+    {
+        elements.push_back(FieldElement(i, 31));
+    }
+    BatchInvert(elements);
+    ASSERT_EQ(elements[0], FieldElement(0, 31));
+    for (int i = 1; i < 31; i++)
+    {
+        ASSERT_EQ(elements[i], FieldElement(i, 31).Inverse());
+    }
+
+    // Chunks inverted in parallel, including a chunk of zeros only
+    const uint256_t prime("fffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f", 16);
+    std::vector<FieldElement<uint256_t>> numbers;
+    for (int i = 0; i < 100; i++)
+    {
+        numbers.push_back(FieldElement<uint256_t>(i < 10 ? uint256_0 : (prime - 1) / (i + 1), prime));
+    }
+    auto expected = numbers;
+    BatchInvert(numbers, 10);
+    for (int i = 0; i < 100; i++)
+    {
+        ASSERT_EQ(numbers[i], i < 10 ? expected[i] : expected[i].Inverse());
+    }
+
+    BatchInvert(numbers.data(), 0);
+
+    // A non-invertible product, possible for a composite modulus, throws from the workers as well
+    std::vector<FieldElement<int>> composite{FieldElement(2, 15), FieldElement(3, 15), FieldElement(4, 15),
+                                             FieldElement(7, 15)};
+    auto copy = composite;
+    ASSERT_THROW(BatchInvert(copy), std::runtime_error);
+    ASSERT_THROW(BatchInvert(composite, 2), std::runtime_error);
+}
+
+TEST(FieldElementTests, SqrtTest)
+{
+    // 31 = 3 (mod 4) takes the (p+1)/4 shortcut, 41 and 97 = 1 (mod 4) go through Tonelli-Shanks
+    for (int prime : {2, 3, 31, 41, 97, 223})
+    {
+        for (int i = 0; i < prime; i++)
+        {
+            auto a = FieldElement(i, prime);
+            bool square = false;
+            for (int j = 0; j < prime; j++)
+            {
+                square = square || (j * j) % prime == i;
+            }
+            ASSERT_EQ(a.IsSquare(), square);
+            if (square)
+            {
+                ASSERT_EQ(a.Sqrt() * a.Sqrt(), a);
+            }
+            else
+            {
+                ASSERT_THROW(a.Sqrt(), std::runtime_error);
+            }
+        }
+    }
+
+    // Jacobi symbols of composite moduli
+    ASSERT_EQ(JacobiSymbol(2, 15), 1);
+    ASSERT_EQ(JacobiSymbol(7, 15), -1);
+    ASSERT_EQ(JacobiSymbol(6, 15), 0);
+    ASSERT_EQ(JacobiSymbol(uint256_t(1001), uint256_t(9907)), -1);
+    ASSERT_EQ(JacobiSymbol(uint256_t(19), uint256_t(45)), 1);
+}
+
+namespace
+{
+struct F31
+{
+    static constexpr int Prime = 31;
+};
+
+struct Secp256k1Prime
+{
+    static constexpr uint256_t Prime = 0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f_u256;
+};
+} // namespace
+
+TEST(FieldElementTests, StaticPrimeTest)
+{
+    using F = FieldElement<int, F31>;
+    static_assert(sizeof(F) == sizeof(int), "a compile time prime is not stored per element");
+    static_assert(sizeof(FieldElement<uint256_t, Secp256k1Prime>) == sizeof(uint256_t), "nor for uint256_t");
+    static_assert(F::StaticPrime && !FieldElement<int>::StaticPrime, "policy detection");
+
+    // Same results as the runtime prime
+    for (int i = 0; i < 31; i++)
+    {
+        for (int j = 1; j < 31; j++)
+        {
+            ASSERT_EQ((F(i) + F(j)).Number, (FieldElement(i, 31) + FieldElement(j, 31)).Number);
+            ASSERT_EQ((F(i) - F(j)).Number, (FieldElement(i, 31) - FieldElement(j, 31)).Number);
+            ASSERT_EQ((F(i) * F(j)).Number, (FieldElement(i, 31) * FieldElement(j, 31)).Number);
+            ASSERT_EQ((F(i) / F(j)).Number, (FieldElement(i, 31) / FieldElement(j, 31)).Number);
+        }
+    }
+    ASSERT_EQ(F(17) ^ -3, F(29));
+    ASSERT_EQ(F(17, 31), F(17));
+    ASSERT_EQ(F(4).Sqrt() * F(4).Sqrt(), F(4));
+    ASSERT_THROW(F(17, 37), std::runtime_error);
+    ASSERT_THROW(F(31), std::runtime_error);
+
+    std::vector<F> elements{F(0), F(3), F(24)};
+    BatchInvert(elements);
+    ASSERT_EQ(elements[0], F(0));
+    ASSERT_EQ(elements[1], F(3).Inverse());
+    ASSERT_EQ(elements[2], F(24).Inverse());
+
+    using S = FieldElement<uint256_t, Secp256k1Prime>;
+    const uint256_t number("79be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798", 16);
+    ASSERT_EQ((S(number) * S(number).Inverse()).Number, 1);
+    const auto runtime = FieldElement(number, Secp256k1Prime::Prime);
+    ASSERT_EQ((S(number) * S(number)).Number, (runtime * runtime).Number);
+}
+
+TEST(FieldElementTests, ExpressionTest)
+{
+    const uint256_t prime("fffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f", 16);
+    auto a = FieldElement<uint256_t>(
+        uint256_t("79be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798", 16), prime);
+    auto b = FieldElement<uint256_t>(
+        uint256_t("483ada7726a3c4655da4fbfc0e1108a8fd17b448a68554199c47d08ffb10d4b8", 16), prime);
+    auto c = FieldElement<uint256_t>(prime - 1, prime);
+    auto d = FieldElement<uint256_t>(2, prime);
+    using Expression = FieldExpression<uint256_t, RuntimePrime<uint256_t>>;
+
+    // One reduction gives the same result as reducing after every step, including negative intermediates
+    ASSERT_EQ(Expression(a).AddProduct(a, b).AddProduct(c, d).Subtract(c).Evaluate(), a * b + c * d - c);
+    ASSERT_EQ(Expression(a).Add(d).SubtractProduct(a, b).SubtractSquare(c).Evaluate(), d - a * b - c * c);
+    ASSERT_EQ(Expression(a).AddSquare(a).SubtractProduct(a, a).Evaluate(), FieldElement<uint256_t>(0, prime));
+    ASSERT_EQ(Expression(a).AddSquare(a).Evaluate(), a.Square());
+    ASSERT_EQ(Expression(a).Evaluate(), FieldElement<uint256_t>(0, prime));
+
+    // Many terms, and a copy that carries on separately
+    auto sum = Expression(a);
+    for (int i = 0; i < 100; i++)
+        sum.AddSquare(c).Subtract(d);
+    auto copy = sum;
+    copy.Add(d);
+    ASSERT_EQ(sum.Evaluate(), FieldElement<uint256_t>(prime - 100, prime));
+    ASSERT_EQ(copy.Evaluate(), FieldElement<uint256_t>(prime - 98, prime));
+
+    // Builtin number types reduce as they go, with the same results
+    auto x = FieldElement(24, 31);
+    auto y = FieldElement(19, 31);
+    auto small = FieldExpression<int, RuntimePrime<int>>(x).AddProduct(x, y).SubtractSquare(y).Add(x);
+    ASSERT_EQ(small.Evaluate(), x * y - y * y + x);
+
+    ASSERT_THROW(Expression(a).AddProduct(a, FieldElement<uint256_t>(1, 7)), std::runtime_error);
+    ASSERT_THROW(Expression(a).Add(FieldElement<uint256_t>(1, 7)), std::runtime_error);
+    ASSERT_THROW(Expression(a).AddSquare(FieldElement<uint256_t>(1, 7)), std::runtime_error);
+}
+
 bool OnCurve(FieldElement<int> x, FieldElement<int> y)
 {
     auto a = FieldElement(0, 223);
@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+
+#include "Helpers.hpp"
+#include "Montgomery.hpp"
+
+using namespace crypto;
+
+namespace
+{
+const uint256_t P("fffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f", 16);
+const uint256_t N("fffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364141", 16);
+const uint256_t A("79be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798", 16);
+const uint256_t B("483ada7726a3c4655da4fbfc0e1108a8fd17b448a68554199c47d08ffb10d4b8", 16);
+} // namespace
+
+TEST(MontgomeryTests, ConstantsTest)
+{
+    auto context = MontgomeryContext(P);
+    ASSERT_EQ(context.One, uint256_t(0x1000003d1ULL));
+    ASSERT_EQ(context.RSquared, mulmod(context.One, context.One, P));
+    ASSERT_EQ(P.limb(0) * -context.Inverse, 1ULL);
+
+    ASSERT_THROW(MontgomeryContext(uint256_t(222)), std::runtime_error);
+    ASSERT_THROW(MontgomeryContext(uint256_t(1)), std::runtime_error);
+}
+
+TEST(MontgomeryTests, RoundTripTest)
+{
+    for (const auto& modulus : {P, N, uint256_t(223), uint256_max})
+    {
+        auto context = MontgomeryContext(modulus);
+        for (const auto& number : {uint256_0, uint256_1, A % modulus, B % modulus, modulus - 1})
+        {
+            ASSERT_EQ(context.FromMontgomery(context.ToMontgomery(number)), number);
+        }
+    }
+}
+
+TEST(MontgomeryTests, MultiplyTest)
+{
+    for (const auto& modulus : {P, N, uint256_t(223), uint256_max})
+    {
+        auto context = MontgomeryContext(modulus);
+        auto a = A % modulus;
+        auto b = B % modulus;
+        for (int i = 0; i < 64; i++)
+        {
+            auto product = context.FromMontgomery(context.Multiply(context.ToMontgomery(a), context.ToMontgomery(b)));
+            ASSERT_EQ(product, mulmod(a, b, modulus));
+
+            auto square = context.FromMontgomery(context.Square(context.ToMontgomery(a)));
+            ASSERT_EQ(square, mulmod(a, a, modulus));
+
+            a = AddModulo(mulmod(a, b, modulus), uint256_1, modulus);
+            b = (b + a) % modulus;
+        }
+
+        auto top = context.ToMontgomery(modulus - 1);
+        ASSERT_EQ(context.FromMontgomery(context.Square(top)), 1);
+        ASSERT_EQ(context.FromMontgomery(context.Multiply(top, top)), 1);
+    }
+}
+
+TEST(MontgomeryTests, PowerTest)
+{
+    auto context = MontgomeryContext(P);
+
+    // Fermat's little theorem
+    ASSERT_EQ(context.FromMontgomery(context.Power(context.ToMontgomery(A), P - 1)), 1);
+    ASSERT_EQ(context.FromMontgomery(context.Power(context.ToMontgomery(A), 0)), 1);
+    ASSERT_EQ(context.FromMontgomery(context.Power(context.ToMontgomery(A), 1)), A);
+
+    auto inverse = PowerModulo(A, P - 2, P);
+    ASSERT_EQ(mulmod(inverse, A, P), 1);
+
+    // Even moduli reduce through Barrett instead
+    ASSERT_EQ(PowerModulo(uint256_t(3), uint256_t(5), uint256_t(100)), 43);
+    ASSERT_EQ(PowerModulo(uint256_t(17), uint256_t(3), uint256_t(223)), uint256_t(17 * 17 * 17 % 223));
+    ASSERT_EQ(PowerModulo(uint256_t(5), uint256_t(0), uint256_t(1)), 0);
+}
+
+TEST(MontgomeryTests, SlidingWindowTest)
+{
+    // Every window width, against the generic square and multiply
+    for (const auto& modulus : {P, N, P - 1, uint256_t(1) << 200, uint256_t(1000)})
+    {
+        for (const auto& exponent :
+             {uint256_0, uint256_1, uint256_t(0x8001), uint256_t(0xffffffffULL), A >> 150, B >> 60, B, N - 2})
+        {
+            ASSERT_EQ(PowerModulo(A, exponent, modulus), PowerModulo<uint256_t>(A, exponent, modulus));
+        }
+    }
+}
@@ -51,3 +51,30 @@ TEST(PointTests, Add4Test)
     EXPECT_THROW(Point<int>(-1, std::nullopt, 1, 2), std::runtime_error);
     EXPECT_THROW(Point<int>(std::nullopt, -1, 1, 2), std::runtime_error);
 }
+
+TEST(PointTests, TrustedTest)
+{
+    // Validation is for points from outside; results of the arithmetic skip it
+    EXPECT_THROW(Point<int>(1, 1, 5, 7), std::runtime_error);
+#ifdef CRYPTO_VALIDATE_TRUSTED
+    EXPECT_THROW(Point<int>::Trusted(1, 1, 5, 7), std::runtime_error);
+    EXPECT_THROW(FieldElement<int>::Trusted(31, RuntimePrime<int>(31)), std::runtime_error);
+#else
+    ASSERT_EQ(Point<int>::Trusted(1, 1, 5, 7).Y.value(), 1);
+    ASSERT_EQ(FieldElement<int>::Trusted(31, RuntimePrime<int>(31)).Number, 31);
+#endif
+    ASSERT_EQ(Point<int>::Trusted(-1, -1, 5, 7) + Point<int>::Trusted(-1, -1, 5, 7), Point(18, 77, 5, 7));
+    EXPECT_THROW(FieldElement(31, 31), std::runtime_error);
+
+    // Integer slopes truncate, so integer results are still checked
+    EXPECT_THROW(Point(2, 5, 5, 7) + Point(18, 77, 5, 7), std::runtime_error);
+}
+
+TEST(PointTests, SquareOfTest)
+{
+    // Field elements square through their own kernel, plain numbers multiply
+    static_assert(HasSquare<FieldElement<int>>::value, "FieldElement has a squaring kernel");
+    static_assert(!HasSquare<int>::value, "int does not");
+    ASSERT_EQ(SquareOf(-7), 49);
+    ASSERT_EQ(SquareOf(FieldElement(24, 31)), FieldElement(24, 31) * FieldElement(24, 31));
+}
@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+
+#include "FieldElement.hpp"
+#include "Point.hpp"
+#include "Secp256k1.hpp"
+#include "Secp256k1Field52.hpp"
+
+using namespace crypto;
+
+namespace
+{
+const uint256_t P = Secp256k1Field::Prime;
+const uint256_t GX("79be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798", 16);
+const uint256_t GY("483ada7726a3c4655da4fbfc0e1108a8fd17b448a68554199c47d08ffb10d4b8", 16);
+} // namespace
+
+TEST(Secp256k1Tests, ConstructorTest)
+{
+    ASSERT_EQ(P, uint256_t("fffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f", 16));
+    ASSERT_EQ(P + Secp256k1Field::C, 0);
+    ASSERT_NO_THROW(Secp256k1FieldElement(P - 1));
+    ASSERT_THROW(Secp256k1FieldElement(P + 0), std::runtime_error);
+}
+
+TEST(Secp256k1Tests, ArithmeticTest)
+{
+    // Values near 0 and p exercise every carry and borrow path of the reduction
+    const uint256_t values[] = {uint256_0, uint256_1, uint256_t(Secp256k1Field::C), GX, GY, P - 1, P - 2, P >> 1,
+                                uint256_max % P};
+    for (const auto& a : values)
+    {
+        for (const auto& b : values)
+        {
+            ASSERT_EQ(Secp256k1Field::Add(a, b), AddModulo(a, b, P));
+            ASSERT_EQ(Secp256k1Field::Subtract(a, b), SubtractModulo(a, b, P));
+            ASSERT_EQ(Secp256k1Field::Multiply(a, b), mulmod(a, b, P));
+        }
+        ASSERT_EQ(Secp256k1Field::Square(a), mulmod(a, a, P));
+    }
+
+    auto a = GX;
+    auto b = GY;
+    for (int i = 0; i < 256; i++)
+    {
+        ASSERT_EQ(Secp256k1Field::Multiply(a, b), mulmod(a, b, P));
+        ASSERT_EQ(Secp256k1Field::Square(a), mulmod(a, a, P));
+        a = Secp256k1Field::Add(Secp256k1Field::Square(a), b);
+        b = Secp256k1Field::Subtract(b, a);
+    }
+}
+
+TEST(Secp256k1Tests, AdditionChainTest)
+{
+    for (const auto& a : {uint256_1, uint256_t(4), GX, GY, P - 1})
+    {
+        ASSERT_EQ(Secp256k1Field::Inverse(a), PowerModulo(a, P - 2, P));
+        ASSERT_EQ(Secp256k1Field::PowerSqrt(a), PowerModulo(a, (P + 1) >> 2, P));
+        ASSERT_EQ(Secp256k1Field::Power(a, P - 2), Secp256k1Field::Inverse(a));
+    }
+
+    // The generator's y coordinate is a square root of x^3 + 7
+    const auto square = Secp256k1Field::Add(Secp256k1Field::Multiply(Secp256k1Field::Square(GX), GX), 7);
+    const auto root = Secp256k1Field::PowerSqrt(square);
+    ASSERT_TRUE(root == GY || root == P - GY);
+}
+
+TEST(Secp256k1Tests, SqrtTest)
+{
+    // Recover the generator from its x coordinate
+    auto x = Secp256k1FieldElement(GX);
+    auto y = (x * x * x + Secp256k1FieldElement(7)).Sqrt();
+    ASSERT_TRUE(y.Number == GY || y.Number == P - GY);
+    ASSERT_TRUE((x * x * x + Secp256k1FieldElement(7)).IsSquare());
+
+    // -1 is not a square when p = 3 (mod 4)
+    ASSERT_FALSE(Secp256k1FieldElement(P - 1).IsSquare());
+    ASSERT_THROW(Secp256k1FieldElement(P - 1).Sqrt(), std::runtime_error);
+    ASSERT_EQ(Secp256k1FieldElement(0).Sqrt(), Secp256k1FieldElement(0));
+
+    // The generic field element agrees, through the same shortcut
+    auto generic = FieldElement<uint256_t>(y.Number, P) * FieldElement<uint256_t>(y.Number, P);
+    ASSERT_EQ(generic.Sqrt() * generic.Sqrt(), generic);
+}
+
+TEST(Secp256k1Tests, FieldElementTest)
+{
+    auto x = Secp256k1FieldElement(GX);
+    auto y = Secp256k1FieldElement(GY);
+    auto generic = FieldElement<uint256_t>(GX, P) * FieldElement<uint256_t>(GY, P);
+
+    ASSERT_EQ((x * y).Number, generic.Number);
+    ASSERT_EQ(x.Square(), x * x);
+    ASSERT_EQ((x / y) * y, x);
+    ASSERT_EQ((x ^ 3), x * x * x);
+    ASSERT_EQ((x ^ -1) * x, Secp256k1FieldElement(1));
+    ASSERT_EQ(x ^ (P - 2), x ^ -1);
+    ASSERT_EQ(Secp256k1FieldElement52(GX) ^ (P - 2), Secp256k1FieldElement52(GX) ^ -1);
+    ASSERT_EQ(3 * x, x + x + x);
+    ASSERT_TRUE(x - x == 0);
+}
+
+TEST(Secp256k1Tests, PointTest)
+{
+    // The generic point formulas instantiate over the specialized field
+    auto a = Secp256k1FieldElement(0);
+    auto b = Secp256k1FieldElement(7);
+    auto generator = Point<Secp256k1FieldElement>(Secp256k1FieldElement(GX), Secp256k1FieldElement(GY), a, b);
+
+    auto doubled = generator + generator;
+    ASSERT_EQ(doubled.X.value().Number,
+              uint256_t("c6047f9441ed7d6d3045406e95c07cd85c778e4b8cef3ca7abac09b95c709ee5", 16));
+    ASSERT_EQ(doubled.Y.value().Number,
+              uint256_t("1ae168fea63dc339a3c58419466ceaeef7f632653266d0e1236431a950cfe52a", 16));
+
+    auto tripled = generator + doubled;
+    ASSERT_EQ(tripled.X.value().Number,
+              uint256_t("f9308a019258c31049344f85f89d5229b531c845836f99b08601f113bce036f9", 16));
+    ASSERT_EQ(tripled.Y.value().Number,
+              uint256_t("388f7b0f632de8140fe337e62a37f3566500a99934c2231b6cb9fd7584b8e672", 16));
+    ASSERT_EQ(generator * 3, tripled);
+}
+
+TEST(Secp256k1Tests, Field52ArithmeticTest)
+{
+    const uint256_t values[] = {uint256_0, uint256_1, uint256_t(Secp256k1Field::C), GX, GY, P - 1, P - 2, P >> 1,
+                                uint256_max % P};
+    for (const auto& a : values)
+    {
+        ASSERT_EQ(Secp256k1FieldElement52(a).ToNumber(), a);
+        for (const auto& b : values)
+        {
+            auto x = Secp256k1FieldElement52(a);
+            auto y = Secp256k1FieldElement52(b);
+            ASSERT_EQ((x + y).ToNumber(), Secp256k1Field::Add(a, b));
+            ASSERT_EQ((x - y).ToNumber(), Secp256k1Field::Subtract(a, b));
+            ASSERT_EQ((x * y).ToNumber(), Secp256k1Field::Multiply(a, b));
+        }
+        ASSERT_EQ(Secp256k1FieldElement52(a).Square().ToNumber(), Secp256k1Field::Square(a));
+    }
+}
+
+TEST(Secp256k1Tests, Field52LazyTest)
+{
+    // Long chains of additions and subtractions only reduce once the magnitude runs out
+    auto x = Secp256k1FieldElement52(P - 1);
+    auto y = Secp256k1FieldElement52(GY);
+    auto expected = P - 1;
+    for (int i = 0; i < 100; i++)
+    {
+        x = (i % 3) ? x + y : x - y;
+        expected = (i % 3) ? Secp256k1Field::Add(expected, GY) : Secp256k1Field::Subtract(expected, GY);
+        ASSERT_LE(x.Magnitude, Secp256k1FieldElement52::MaxMagnitude);
+        ASSERT_EQ(x.ToNumber(), expected);
+
+        // Products accept any magnitude and come back at 1
+        auto product = x * x;
+        ASSERT_EQ(product.Magnitude, 1);
+        ASSERT_EQ(product.ToNumber(), Secp256k1Field::Square(expected));
+        ASSERT_EQ(x.Square(), product);
+    }
+}
+
+TEST(Secp256k1Tests, Field52PointTest)
+{
+    auto a = Secp256k1FieldElement52(0);
+    auto b = Secp256k1FieldElement52(7);
+    auto generator = Point<Secp256k1FieldElement52>(Secp256k1FieldElement52(GX), Secp256k1FieldElement52(GY), a, b);
+
+    auto doubled = generator + generator;
+    ASSERT_EQ(doubled.X.value().ToNumber(),
+              uint256_t("c6047f9441ed7d6d3045406e95c07cd85c778e4b8cef3ca7abac09b95c709ee5", 16));
+    ASSERT_EQ(doubled.Y.value().ToNumber(),
+              uint256_t("1ae168fea63dc339a3c58419466ceaeef7f632653266d0e1236431a950cfe52a", 16));
+
+    auto tripled = generator + doubled;
+    ASSERT_EQ(tripled.X.value().ToNumber(),
+              uint256_t("f9308a019258c31049344f85f89d5229b531c845836f99b08601f113bce036f9", 16));
+    ASSERT_EQ(tripled.Y.value().ToNumber(),
+              uint256_t("388f7b0f632de8140fe337e62a37f3566500a99934c2231b6cb9fd7584b8e672", 16));
+    ASSERT_EQ(generator * 3, tripled);
+    ASSERT_EQ((Secp256k1FieldElement52(GX) / Secp256k1FieldElement52(GY)).ToNumber(),
+              (Secp256k1FieldElement(GX) / Secp256k1FieldElement(GY)).Number);
+}
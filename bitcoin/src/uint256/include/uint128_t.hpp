@@ -44,6 +44,7 @@ to do a general rewrite of this class.
 
 #include "endianness.h"
 #include "uint256_t_config.hpp"
+#include "uint256_t_limbs.hpp"
 
 #define UINT256_T_EXTERN _UINT256_T_EXPORT
 
@@ -67,10 +68,10 @@ class uint128_t
 {
   private:
 #ifdef __BIG_ENDIAN__
-    uint64_t UPPER, LOWER;
+    uint64_t UPPER = 0, LOWER = 0;
 #endif
 #ifdef __LITTLE_ENDIAN__
-    uint64_t LOWER, UPPER;
+    uint64_t LOWER = 0, UPPER = 0;
 #endif
 
   public:
@@ -80,10 +81,10 @@ class uint128_t
     uint128_t(uint128_t&& rhs) = default;
     uint128_t(std::string& s);
     uint128_t(const char* s);
-    uint128_t(const bool& b);
+    constexpr uint128_t(const bool& b);
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint128_t(const T& rhs)
+    constexpr uint128_t(const T& rhs)
 #ifdef __BIG_ENDIAN__
       : UPPER(0)
       , LOWER(rhs)
@@ -104,7 +105,7 @@ class uint128_t
 
     template<typename S, typename T,
              typename = typename std::enable_if<std::is_integral<S>::value && std::is_integral<T>::value, void>::type>
-    uint128_t(const S& upper_rhs, const T& lower_rhs)
+    constexpr uint128_t(const S& upper_rhs, const T& lower_rhs)
 #ifdef __BIG_ENDIAN__
       : UPPER(upper_rhs)
       , LOWER(lower_rhs)
@@ -123,7 +124,7 @@ class uint128_t
     uint128_t& operator=(uint128_t&& rhs) = default;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint128_t& operator=(const T& rhs)
+    constexpr uint128_t& operator=(const T& rhs)
     {
         UPPER = 0;
 
@@ -139,327 +140,666 @@ class uint128_t
         return *this;
     }
 
-    uint128_t& operator=(const bool& rhs);
+    constexpr uint128_t& operator=(const bool& rhs);
 
     // Typecast Operators
-    operator bool() const;
-    operator uint8_t() const;
-    operator uint16_t() const;
-    operator uint32_t() const;
-    operator uint64_t() const;
+    constexpr operator bool() const;
+    constexpr operator uint8_t() const;
+    constexpr operator uint16_t() const;
+    constexpr operator uint32_t() const;
+    constexpr operator uint64_t() const;
 
     // Bitwise Operators
-    uint128_t operator&(const uint128_t& rhs) const;
+    constexpr uint128_t operator&(const uint128_t& rhs) const;
 
     void export_bits(std::vector<uint8_t>& ret) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint128_t operator&(const T& rhs) const
+    constexpr uint128_t operator&(const T& rhs) const
     {
         return uint128_t(0, LOWER & (uint64_t)rhs);
     }
 
-    uint128_t& operator&=(const uint128_t& rhs);
+    constexpr uint128_t& operator&=(const uint128_t& rhs);
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint128_t& operator&=(const T& rhs)
+    constexpr uint128_t& operator&=(const T& rhs)
     {
         UPPER = 0;
         LOWER &= rhs;
         return *this;
     }
 
-    uint128_t operator|(const uint128_t& rhs) const;
+    constexpr uint128_t operator|(const uint128_t& rhs) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint128_t operator|(const T& rhs) const
+    constexpr uint128_t operator|(const T& rhs) const
     {
         return uint128_t(UPPER, LOWER | (uint64_t)rhs);
     }
 
-    uint128_t& operator|=(const uint128_t& rhs);
+    constexpr uint128_t& operator|=(const uint128_t& rhs);
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint128_t& operator|=(const T& rhs)
+    constexpr uint128_t& operator|=(const T& rhs)
     {
         LOWER |= (uint64_t)rhs;
         return *this;
     }
 
-    uint128_t operator^(const uint128_t& rhs) const;
+    constexpr uint128_t operator^(const uint128_t& rhs) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint128_t operator^(const T& rhs) const
+    constexpr uint128_t operator^(const T& rhs) const
     {
         return uint128_t(UPPER, LOWER ^ (uint64_t)rhs);
     }
 
-    uint128_t& operator^=(const uint128_t& rhs);
+    constexpr uint128_t& operator^=(const uint128_t& rhs);
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint128_t& operator^=(const T& rhs)
+    constexpr uint128_t& operator^=(const T& rhs)
     {
         LOWER ^= (uint64_t)rhs;
         return *this;
     }
 
-    uint128_t operator~() const;
+    constexpr uint128_t operator~() const;
 
     // Bit Shift Operators
-    uint128_t operator<<(const uint128_t& rhs) const;
+    constexpr uint128_t operator<<(const uint128_t& rhs) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint128_t operator<<(const T& rhs) const
+    constexpr uint128_t operator<<(const T& rhs) const
     {
         return *this << uint128_t(rhs);
     }
 
-    uint128_t& operator<<=(const uint128_t& rhs);
+    constexpr uint128_t& operator<<=(const uint128_t& rhs);
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint128_t& operator<<=(const T& rhs)
+    constexpr uint128_t& operator<<=(const T& rhs)
     {
         *this = *this << uint128_t(rhs);
         return *this;
     }
 
-    uint128_t operator>>(const uint128_t& rhs) const;
+    constexpr uint128_t operator>>(const uint128_t& rhs) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint128_t operator>>(const T& rhs) const
+    constexpr uint128_t operator>>(const T& rhs) const
     {
         return *this >> uint128_t(rhs);
     }
 
-    uint128_t& operator>>=(const uint128_t& rhs);
+    constexpr uint128_t& operator>>=(const uint128_t& rhs);
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint128_t& operator>>=(const T& rhs)
+    constexpr uint128_t& operator>>=(const T& rhs)
     {
         *this = *this >> uint128_t(rhs);
         return *this;
     }
 
     // Logical Operators
-    bool operator!() const;
-    bool operator&&(const uint128_t& rhs) const;
-    bool operator||(const uint128_t& rhs) const;
+    constexpr bool operator!() const;
+    constexpr bool operator&&(const uint128_t& rhs) const;
+    constexpr bool operator||(const uint128_t& rhs) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    bool operator&&(const T& rhs)
+    constexpr bool operator&&(const T& rhs)
     {
         return static_cast<bool>(*this && rhs);
     }
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    bool operator||(const T& rhs)
+    constexpr bool operator||(const T& rhs)
     {
         return static_cast<bool>(*this || rhs);
     }
 
     // Comparison Operators
-    bool operator==(const uint128_t& rhs) const;
+    constexpr bool operator==(const uint128_t& rhs) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    bool operator==(const T& rhs) const
+    constexpr bool operator==(const T& rhs) const
     {
         return (!UPPER && (LOWER == (uint64_t)rhs));
     }
 
-    bool operator!=(const uint128_t& rhs) const;
+    constexpr bool operator!=(const uint128_t& rhs) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    bool operator!=(const T& rhs) const
+    constexpr bool operator!=(const T& rhs) const
     {
         return (UPPER | (LOWER != (uint64_t)rhs));
     }
 
-    bool operator>(const uint128_t& rhs) const;
+    constexpr bool operator>(const uint128_t& rhs) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    bool operator>(const T& rhs) const
+    constexpr bool operator>(const T& rhs) const
     {
         return (UPPER || (LOWER > (uint64_t)rhs));
     }
 
-    bool operator<(const uint128_t& rhs) const;
+    constexpr bool operator<(const uint128_t& rhs) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    bool operator<(const T& rhs) const
+    constexpr bool operator<(const T& rhs) const
     {
         return (!UPPER) ? (LOWER < (uint64_t)rhs) : false;
     }
 
-    bool operator>=(const uint128_t& rhs) const;
+    constexpr bool operator>=(const uint128_t& rhs) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    bool operator>=(const T& rhs) const
+    constexpr bool operator>=(const T& rhs) const
     {
         return ((*this > rhs) | (*this == rhs));
     }
 
-    bool operator<=(const uint128_t& rhs) const;
+    constexpr bool operator<=(const uint128_t& rhs) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    bool operator<=(const T& rhs) const
+    constexpr bool operator<=(const T& rhs) const
     {
         return ((*this < rhs) | (*this == rhs));
     }
 
     // Arithmetic Operators
-    uint128_t operator+(const uint128_t& rhs) const;
+    constexpr uint128_t operator+(const uint128_t& rhs) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint128_t operator+(const T& rhs) const
+    constexpr uint128_t operator+(const T& rhs) const
     {
         return uint128_t(UPPER + ((LOWER + (uint64_t)rhs) < LOWER), LOWER + (uint64_t)rhs);
     }
 
-    uint128_t& operator+=(const uint128_t& rhs);
+    constexpr uint128_t& operator+=(const uint128_t& rhs);
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint128_t& operator+=(const T& rhs)
+    constexpr uint128_t& operator+=(const T& rhs)
     {
         return *this += uint128_t(rhs);
     }
 
-    uint128_t operator-(const uint128_t& rhs) const;
+    constexpr uint128_t operator-(const uint128_t& rhs) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint128_t operator-(const T& rhs) const
+    constexpr uint128_t operator-(const T& rhs) const
     {
         return uint128_t((uint64_t)(UPPER - ((LOWER - rhs) > LOWER)), (uint64_t)(LOWER - rhs));
     }
 
-    uint128_t& operator-=(const uint128_t& rhs);
+    constexpr uint128_t& operator-=(const uint128_t& rhs);
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint128_t& operator-=(const T& rhs)
+    constexpr uint128_t& operator-=(const T& rhs)
     {
         return *this = *this - uint128_t(rhs);
     }
 
-    uint128_t operator*(const uint128_t& rhs) const;
+    constexpr uint128_t operator*(const uint128_t& rhs) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint128_t operator*(const T& rhs) const
+    constexpr uint128_t operator*(const T& rhs) const
     {
         return *this * uint128_t(rhs);
     }
 
-    uint128_t& operator*=(const uint128_t& rhs);
+    constexpr uint128_t& operator*=(const uint128_t& rhs);
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint128_t& operator*=(const T& rhs)
+    constexpr uint128_t& operator*=(const T& rhs)
     {
         return *this = *this * uint128_t(rhs);
     }
 
   private:
-    std::pair<uint128_t, uint128_t> divmod(const uint128_t& lhs, const uint128_t& rhs) const;
+    constexpr std::pair<uint128_t, uint128_t> divmod(const uint128_t& lhs, const uint128_t& rhs) const;
     void init(const char* s);
     void ConvertToVector(std::vector<uint8_t>& current, const uint64_t& val) const;
     uint8_t HexToInt(const char* s) const;
     uint64_t ConvertToUint64(const char* s) const;
 
   public:
-    uint128_t operator/(const uint128_t& rhs) const;
+    constexpr uint128_t operator/(const uint128_t& rhs) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint128_t operator/(const T& rhs) const
+    constexpr uint128_t operator/(const T& rhs) const
     {
         return *this / uint128_t(rhs);
     }
 
-    uint128_t& operator/=(const uint128_t& rhs);
+    constexpr uint128_t& operator/=(const uint128_t& rhs);
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint128_t& operator/=(const T& rhs)
+    constexpr uint128_t& operator/=(const T& rhs)
     {
         return *this = *this / uint128_t(rhs);
     }
 
-    uint128_t operator%(const uint128_t& rhs) const;
+    constexpr uint128_t operator%(const uint128_t& rhs) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint128_t operator%(const T& rhs) const
+    constexpr uint128_t operator%(const T& rhs) const
     {
         return *this % uint128_t(rhs);
     }
 
-    uint128_t& operator%=(const uint128_t& rhs);
+    constexpr uint128_t& operator%=(const uint128_t& rhs);
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint128_t& operator%=(const T& rhs)
+    constexpr uint128_t& operator%=(const T& rhs)
     {
         return *this = *this % uint128_t(rhs);
     }
 
     // Increment Operator
-    uint128_t& operator++();
-    uint128_t operator++(int);
+    constexpr uint128_t& operator++();
+    constexpr uint128_t operator++(int);
 
     // Decrement Operator
-    uint128_t& operator--();
-    uint128_t operator--(int);
+    constexpr uint128_t& operator--();
+    constexpr uint128_t operator--(int);
 
     // Nothing done since promotion doesn't work here
-    uint128_t operator+() const;
+    constexpr uint128_t operator+() const;
 
     // two's complement
-    uint128_t operator-() const;
+    constexpr uint128_t operator-() const;
 
     // Get private values
-    const uint64_t& upper() const;
-    const uint64_t& lower() const;
+    constexpr const uint64_t& upper() const;
+    constexpr const uint64_t& lower() const;
 
     // Get bitsize of value
-    uint8_t bits() const;
+    constexpr uint8_t bits() const;
 
     // Get string representation of value
     std::string str(uint8_t base = 10, const unsigned int& len = 0) const;
 };
 
 // useful values
-UINT256_T_EXTERN extern const uint128_t uint128_0;
-UINT256_T_EXTERN extern const uint128_t uint128_1;
+inline constexpr uint128_t uint128_0(0);
+inline constexpr uint128_t uint128_1(1);
+
+// Everything usable in constant expressions is defined inline below
+
+constexpr uint128_t::uint128_t(const bool& b)
+  : uint128_t((uint8_t)b)
+{
+}
+
+constexpr uint128_t& uint128_t::operator=(const bool& rhs)
+{
+    UPPER = 0;
+    LOWER = rhs;
+    return *this;
+}
+
+constexpr uint128_t::operator bool() const
+{
+    return (bool)(UPPER | LOWER);
+}
+
+constexpr uint128_t::operator uint8_t() const
+{
+    return (uint8_t)LOWER;
+}
+
+constexpr uint128_t::operator uint16_t() const
+{
+    return (uint16_t)LOWER;
+}
+
+constexpr uint128_t::operator uint32_t() const
+{
+    return (uint32_t)LOWER;
+}
+
+constexpr uint128_t::operator uint64_t() const
+{
+    return (uint64_t)LOWER;
+}
+
+constexpr uint128_t uint128_t::operator&(const uint128_t& rhs) const
+{
+    return uint128_t(UPPER & rhs.UPPER, LOWER & rhs.LOWER);
+}
+
+constexpr uint128_t& uint128_t::operator&=(const uint128_t& rhs)
+{
+    UPPER &= rhs.UPPER;
+    LOWER &= rhs.LOWER;
+    return *this;
+}
+
+constexpr uint128_t uint128_t::operator|(const uint128_t& rhs) const
+{
+    return uint128_t(UPPER | rhs.UPPER, LOWER | rhs.LOWER);
+}
+
+constexpr uint128_t& uint128_t::operator|=(const uint128_t& rhs)
+{
+    UPPER |= rhs.UPPER;
+    LOWER |= rhs.LOWER;
+    return *this;
+}
+
+constexpr uint128_t uint128_t::operator^(const uint128_t& rhs) const
+{
+    return uint128_t(UPPER ^ rhs.UPPER, LOWER ^ rhs.LOWER);
+}
+
+constexpr uint128_t& uint128_t::operator^=(const uint128_t& rhs)
+{
+    UPPER ^= rhs.UPPER;
+    LOWER ^= rhs.LOWER;
+    return *this;
+}
+
+constexpr uint128_t uint128_t::operator~() const
+{
+    return uint128_t(~UPPER, ~LOWER);
+}
+
+constexpr uint128_t uint128_t::operator<<(const uint128_t& rhs) const
+{
+    const uint64_t shift = rhs.LOWER;
+    if (((bool)rhs.UPPER) || (shift >= 128))
+    {
+        return uint128_0;
+    }
+    else if (shift == 64)
+    {
+        return uint128_t(LOWER, 0);
+    }
+    else if (shift == 0)
+    {
+        return *this;
+    }
+    else if (shift < 64)
+    {
+        return uint128_t((UPPER << shift) + (LOWER >> (64 - shift)), LOWER << shift);
+    }
+    else if ((128 > shift) && (shift > 64))
+    {
+        return uint128_t(LOWER << (shift - 64), 0);
+    }
+    else
+    {
+        return uint128_0;
+    }
+}
+
+constexpr uint128_t& uint128_t::operator<<=(const uint128_t& rhs)
+{
+    *this = *this << rhs;
+    return *this;
+}
+
+constexpr uint128_t uint128_t::operator>>(const uint128_t& rhs) const
+{
+    const uint64_t shift = rhs.LOWER;
+    if (((bool)rhs.UPPER) || (shift >= 128))
+    {
+        return uint128_0;
+    }
+    else if (shift == 64)
+    {
+        return uint128_t(0, UPPER);
+    }
+    else if (shift == 0)
+    {
+        return *this;
+    }
+    else if (shift < 64)
+    {
+        return uint128_t(UPPER >> shift, (UPPER << (64 - shift)) + (LOWER >> shift));
+    }
+    else if ((128 > shift) && (shift > 64))
+    {
+        return uint128_t(0, (UPPER >> (shift - 64)));
+    }
+    else
+    {
+        return uint128_0;
+    }
+}
+
+constexpr uint128_t& uint128_t::operator>>=(const uint128_t& rhs)
+{
+    *this = *this >> rhs;
+    return *this;
+}
+
+constexpr bool uint128_t::operator!() const
+{
+    return !(bool)(UPPER | LOWER);
+}
+
+constexpr bool uint128_t::operator&&(const uint128_t& rhs) const
+{
+    return ((bool)*this && rhs);
+}
+
+constexpr bool uint128_t::operator||(const uint128_t& rhs) const
+{
+    return ((bool)*this || rhs);
+}
+
+constexpr bool uint128_t::operator==(const uint128_t& rhs) const
+{
+    return ((UPPER == rhs.UPPER) && (LOWER == rhs.LOWER));
+}
+
+constexpr bool uint128_t::operator!=(const uint128_t& rhs) const
+{
+    return ((UPPER != rhs.UPPER) | (LOWER != rhs.LOWER));
+}
+
+constexpr bool uint128_t::operator>(const uint128_t& rhs) const
+{
+    if (UPPER == rhs.UPPER)
+    {
+        return (LOWER > rhs.LOWER);
+    }
+    return (UPPER > rhs.UPPER);
+}
+
+constexpr bool uint128_t::operator<(const uint128_t& rhs) const
+{
+    if (UPPER == rhs.UPPER)
+    {
+        return (LOWER < rhs.LOWER);
+    }
+    return (UPPER < rhs.UPPER);
+}
+
+constexpr bool uint128_t::operator>=(const uint128_t& rhs) const
+{
+    return ((*this > rhs) | (*this == rhs));
+}
+
+constexpr bool uint128_t::operator<=(const uint128_t& rhs) const
+{
+    return ((*this < rhs) | (*this == rhs));
+}
+
+constexpr uint128_t uint128_t::operator+(const uint128_t& rhs) const
+{
+    return uint128_t(UPPER + rhs.UPPER + ((LOWER + rhs.LOWER) < LOWER), LOWER + rhs.LOWER);
+}
+
+constexpr uint128_t& uint128_t::operator+=(const uint128_t& rhs)
+{
+    UPPER += rhs.UPPER + ((LOWER + rhs.LOWER) < LOWER);
+    LOWER += rhs.LOWER;
+    return *this;
+}
+
+constexpr uint128_t uint128_t::operator-(const uint128_t& rhs) const
+{
+    return uint128_t(UPPER - rhs.UPPER - ((LOWER - rhs.LOWER) > LOWER), LOWER - rhs.LOWER);
+}
+
+constexpr uint128_t& uint128_t::operator-=(const uint128_t& rhs)
+{
+    *this = *this - rhs;
+    return *this;
+}
+
+constexpr uint128_t uint128_t::operator*(const uint128_t& rhs) const
+{
+    // Only the low limbs need a full 64x64-bit product, the cross products land entirely in the upper limb
+    uint64_t high = 0;
+    const uint64_t low = uint256_limbs::mul(LOWER, rhs.LOWER, high);
+    return uint128_t(high + LOWER * rhs.UPPER + UPPER * rhs.LOWER, low);
+}
+
+constexpr uint128_t& uint128_t::operator*=(const uint128_t& rhs)
+{
+    *this = *this * rhs;
+    return *this;
+}
+
+constexpr std::pair<uint128_t, uint128_t> uint128_t::divmod(const uint128_t& lhs, const uint128_t& rhs) const
+{
+    // Save some calculations /////////////////////
+    if (rhs == uint128_0)
+    {
+        throw std::domain_error("Error: division or modulus by 0");
+    }
+    else if (rhs == uint128_1)
+    {
+        return std::pair<uint128_t, uint128_t>(lhs, uint128_0);
+    }
+    else if (lhs == rhs)
+    {
+        return std::pair<uint128_t, uint128_t>(uint128_1, uint128_0);
+    }
+    else if ((lhs == uint128_0) || (lhs < rhs))
+    {
+        return std::pair<uint128_t, uint128_t>(uint128_0, lhs);
+    }
+
+    const uint64_t u[2] = {lhs.LOWER, lhs.UPPER};
+    const uint64_t v[2] = {rhs.LOWER, rhs.UPPER};
+    uint64_t q[2] = {0, 0};
+    uint64_t r[2] = {0, 0};
+    uint256_limbs::divmod<2>(u, uint256_limbs::significant(u, 2), v, uint256_limbs::significant(v, 2), q, r);
+    return std::pair<uint128_t, uint128_t>(uint128_t(q[1], q[0]), uint128_t(r[1], r[0]));
+}
+
+constexpr uint128_t uint128_t::operator/(const uint128_t& rhs) const
+{
+    return divmod(*this, rhs).first;
+}
+
+constexpr uint128_t& uint128_t::operator/=(const uint128_t& rhs)
+{
+    *this = *this / rhs;
+    return *this;
+}
+
+constexpr uint128_t uint128_t::operator%(const uint128_t& rhs) const
+{
+    return divmod(*this, rhs).second;
+}
+
+constexpr uint128_t& uint128_t::operator%=(const uint128_t& rhs)
+{
+    *this = *this % rhs;
+    return *this;
+}
+
+constexpr uint128_t& uint128_t::operator++()
+{
+    return *this += uint128_1;
+}
+
+constexpr uint128_t uint128_t::operator++(int)
+{
+    uint128_t temp(*this);
+    ++*this;
+    return temp;
+}
+
+constexpr uint128_t& uint128_t::operator--()
+{
+    return *this -= uint128_1;
+}
+
+constexpr uint128_t uint128_t::operator--(int)
+{
+    uint128_t temp(*this);
+    --*this;
+    return temp;
+}
+
+constexpr uint128_t uint128_t::operator+() const
+{
+    return *this;
+}
+
+constexpr uint128_t uint128_t::operator-() const
+{
+    return ~*this + uint128_1;
+}
+
+constexpr const uint64_t& uint128_t::upper() const
+{
+    return UPPER;
+}
+
+constexpr const uint64_t& uint128_t::lower() const
+{
+    return LOWER;
+}
+
+constexpr uint8_t uint128_t::bits() const
+{
+    return UPPER ? 128 - uint256_limbs::clz(UPPER) : 64 - uint256_limbs::clz(LOWER);
+}
 
 // lhs type T as first arguemnt
 // If the output is not a bool, casts to type T
 
 // Bitwise Operators
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-uint128_t operator&(const T& lhs, const uint128_t& rhs)
+constexpr uint128_t operator&(const T& lhs, const uint128_t& rhs)
 {
     return rhs & lhs;
 }
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-T& operator&=(T& lhs, const uint128_t& rhs)
+constexpr T& operator&=(T& lhs, const uint128_t& rhs)
 {
     return lhs = static_cast<T>(rhs & lhs);
 }
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-uint128_t operator|(const T& lhs, const uint128_t& rhs)
+constexpr uint128_t operator|(const T& lhs, const uint128_t& rhs)
 {
     return rhs | lhs;
 }
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-T& operator|=(T& lhs, const uint128_t& rhs)
+constexpr T& operator|=(T& lhs, const uint128_t& rhs)
 {
     return lhs = static_cast<T>(rhs | lhs);
 }
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-uint128_t operator^(const T& lhs, const uint128_t& rhs)
+constexpr uint128_t operator^(const T& lhs, const uint128_t& rhs)
 {
     return rhs ^ lhs;
 }
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-T& operator^=(T& lhs, const uint128_t& rhs)
+constexpr T& operator^=(T& lhs, const uint128_t& rhs)
 {
     return lhs = static_cast<T>(rhs ^ lhs);
 }
@@ -476,7 +816,7 @@ UINT256_T_EXTERN uint128_t operator<<(const int32_t& lhs, const uint128_t& rhs);
 UINT256_T_EXTERN uint128_t operator<<(const int64_t& lhs, const uint128_t& rhs);
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-T& operator<<=(T& lhs, const uint128_t& rhs)
+constexpr T& operator<<=(T& lhs, const uint128_t& rhs)
 {
     return lhs = static_cast<T>(uint128_t(lhs) << rhs);
 }
@@ -492,32 +832,32 @@ UINT256_T_EXTERN uint128_t operator>>(const int32_t& lhs, const uint128_t& rhs);
 UINT256_T_EXTERN uint128_t operator>>(const int64_t& lhs, const uint128_t& rhs);
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-T& operator>>=(T& lhs, const uint128_t& rhs)
+constexpr T& operator>>=(T& lhs, const uint128_t& rhs)
 {
     return lhs = static_cast<T>(uint128_t(lhs) >> rhs);
 }
 
 // Comparison Operators
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-bool operator==(const T& lhs, const uint128_t& rhs)
+constexpr bool operator==(const T& lhs, const uint128_t& rhs)
 {
     return (!rhs.upper() && ((uint64_t)lhs == rhs.lower()));
 }
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-bool operator!=(const T& lhs, const uint128_t& rhs)
+constexpr bool operator!=(const T& lhs, const uint128_t& rhs)
 {
     return (rhs.upper() | ((uint64_t)lhs != rhs.lower()));
 }
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-bool operator>(const T& lhs, const uint128_t& rhs)
+constexpr bool operator>(const T& lhs, const uint128_t& rhs)
 {
     return (!rhs.upper()) && ((uint64_t)lhs > rhs.lower());
 }
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-bool operator<(const T& lhs, const uint128_t& rhs)
+constexpr bool operator<(const T& lhs, const uint128_t& rhs)
 {
     if (rhs.upper())
     {
@@ -527,7 +867,7 @@ bool operator<(const T& lhs, const uint128_t& rhs)
 }
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-bool operator>=(const T& lhs, const uint128_t& rhs)
+constexpr bool operator>=(const T& lhs, const uint128_t& rhs)
 {
     if (rhs.upper())
     {
@@ -537,7 +877,7 @@ bool operator>=(const T& lhs, const uint128_t& rhs)
 }
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-bool operator<=(const T& lhs, const uint128_t& rhs)
+constexpr bool operator<=(const T& lhs, const uint128_t& rhs)
 {
     if (rhs.upper())
     {
@@ -548,65 +888,70 @@ bool operator<=(const T& lhs, const uint128_t& rhs)
 
 // Arithmetic Operators
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-uint128_t operator+(const T& lhs, const uint128_t& rhs)
+constexpr uint128_t operator+(const T& lhs, const uint128_t& rhs)
 {
     return rhs + lhs;
 }
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-T& operator+=(T& lhs, const uint128_t& rhs)
+constexpr T& operator+=(T& lhs, const uint128_t& rhs)
 {
     return lhs = static_cast<T>(rhs + lhs);
 }
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-uint128_t operator-(const T& lhs, const uint128_t& rhs)
+constexpr uint128_t operator-(const T& lhs, const uint128_t& rhs)
 {
     return -(rhs - lhs);
 }
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-T& operator-=(T& lhs, const uint128_t& rhs)
+constexpr T& operator-=(T& lhs, const uint128_t& rhs)
 {
     return lhs = static_cast<T>(-(rhs - lhs));
 }
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-uint128_t operator*(const T& lhs, const uint128_t& rhs)
+constexpr uint128_t operator*(const T& lhs, const uint128_t& rhs)
 {
     return rhs * lhs;
 }
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-T& operator*=(T& lhs, const uint128_t& rhs)
+constexpr T& operator*=(T& lhs, const uint128_t& rhs)
 {
     return lhs = static_cast<T>(rhs * lhs);
 }
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-uint128_t operator/(const T& lhs, const uint128_t& rhs)
+constexpr uint128_t operator/(const T& lhs, const uint128_t& rhs)
 {
     return uint128_t(lhs) / rhs;
 }
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-T& operator/=(T& lhs, const uint128_t& rhs)
+constexpr T& operator/=(T& lhs, const uint128_t& rhs)
 {
     return lhs = static_cast<T>(uint128_t(lhs) / rhs);
 }
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-uint128_t operator%(const T& lhs, const uint128_t& rhs)
+constexpr uint128_t operator%(const T& lhs, const uint128_t& rhs)
 {
     return uint128_t(lhs) % rhs;
 }
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-T& operator%=(T& lhs, const uint128_t& rhs)
+constexpr T& operator%=(T& lhs, const uint128_t& rhs)
 {
     return lhs = static_cast<T>(uint128_t(lhs) % rhs);
 }
 
 // IO Operator
 UINT256_T_EXTERN std::ostream& operator<<(std::ostream& stream, const uint128_t& rhs);
+
+#ifdef UINT256_T_HEADER_ONLY
+#include "../src/uint128_t.cpp"
+#endif
+
 #endif
@@ -0,0 +1,75 @@
+/*
+uint256_batch.hpp
+Batches of uint256_t stored as limb columns
+
+Holds N values structure-of-arrays style, one column per 64-bit limb, so
+that the element-wise operations can load four values of the same limb
+into one AVX2 register. The AVX2 kernels are picked at run time when the
+CPU supports them; otherwise portable scalar loops do the same work.
+*/
+
+#ifndef __UINT256_BATCH__
+#define __UINT256_BATCH__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "uint256_t.hpp"
+#include "uint256_t_config.hpp"
+
+class UINT256_T_EXTERN uint256_batch_t;
+
+class uint256_batch_t
+{
+  private:
+    std::size_t SIZE;
+    // Four columns, least significant limb first
+    std::vector<uint64_t> LIMBS[4];
+
+    // Whether the kernels below run on AVX2. Each operation reads it once, so switching kernels
+    // while other threads run batch operations is safe
+    static std::atomic<bool>& avx2();
+    // Column pointers for the kernels
+    void columns(const uint64_t* (&out)[4]) const;
+    void columns(uint64_t* (&out)[4]);
+
+  public:
+    // Constructors
+    uint256_batch_t(const std::size_t size = 0);
+    uint256_batch_t(const std::vector<uint256_t>& values);
+
+    // Element access
+    std::size_t size() const;
+    void resize(const std::size_t size);
+    uint256_t get(const std::size_t index) const;
+    void set(const std::size_t index, const uint256_t& value);
+
+    // Element-wise operations over batches of equal size. out is resized to match
+    // and may be the same batch as either input
+    static void add(uint256_batch_t& out, const uint256_batch_t& lhs, const uint256_batch_t& rhs);
+    static void sub(uint256_batch_t& out, const uint256_batch_t& lhs, const uint256_batch_t& rhs);
+    // mask[i] is all ones where lhs[i] < rhs[i], zero otherwise
+    static void less(std::vector<uint64_t>& mask, const uint256_batch_t& lhs, const uint256_batch_t& rhs);
+    // out[i] = mask[i] ? lhs[i] : rhs[i], for masks of all ones or zero
+    static void select(uint256_batch_t& out, const std::vector<uint64_t>& mask, const uint256_batch_t& lhs,
+                       const uint256_batch_t& rhs);
+    // Modular addition and subtraction of values already below the modulus
+    static void add_mod(uint256_batch_t& out, const uint256_batch_t& lhs, const uint256_batch_t& rhs,
+                        const uint256_t& modulus);
+    static void sub_mod(uint256_batch_t& out, const uint256_batch_t& lhs, const uint256_batch_t& rhs,
+                        const uint256_t& modulus);
+
+    // Turns the AVX2 kernels on or off and returns whether they are in use.
+    // They can only be turned on where the CPU supports them. Safe to call while
+    // other threads run batch operations
+    static bool use_avx2(const bool enable);
+    static bool uses_avx2();
+};
+
+#ifdef UINT256_T_HEADER_ONLY
+#include "../src/uint256_batch.cpp"
+#endif
+
+#endif
@@ -31,6 +31,9 @@ to do a general rewrite of this class.
 #ifndef __UINT256_T__
 #define __UINT256_T__
 
+#include <array>
+#include <charconv>
+#include <cstddef>
 #include <cstdint>
 #include <ostream>
 #include <stdexcept>
@@ -41,6 +44,7 @@ to do a general rewrite of this class.
 #define UINT256_T_EXTERN _UINT256_T_EXPORT
 
 #include "uint128_t.hpp"
+#include "uint256_t_limbs.hpp"
 
 class UINT256_T_EXTERN uint256_t;
 
@@ -60,13 +64,12 @@ template<> struct is_unsigned<uint256_t> : std::true_type
 
 class uint256_t
 {
+    friend std::to_chars_result to_chars(char* first, char* last, const uint256_t& value, int base);
+    friend std::from_chars_result from_chars(const char* first, const char* last, uint256_t& value, int base);
+
   private:
-#ifdef __BIG_ENDIAN__
-    uint128_t UPPER, LOWER;
-#endif
-#ifdef __LITTLE_ENDIAN__
-    uint128_t LOWER, UPPER;
-#endif
+    // Four 64-bit limbs, least significant first
+    uint64_t LIMBS[4] = {0, 0, 0, 0};
 
   public:
     // Constructors
@@ -77,62 +80,27 @@ class uint256_t
     uint256_t(const char* val);
     uint256_t(const std::string& s, uint8_t base);
     uint256_t(const char* val, uint8_t base);
-    uint256_t(const bool& b);
+    constexpr uint256_t(const bool& b);
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint256_t(const T& rhs)
-#ifdef __BIG_ENDIAN__
-      : UPPER(uint128_0)
-      , LOWER(rhs)
-#endif
-#ifdef __LITTLE_ENDIAN__
-      : LOWER(rhs)
-      , UPPER(uint128_0)
-#endif
+    constexpr uint256_t(const T& rhs)
+      : LIMBS{(uint64_t)rhs, sign_fill(rhs), sign_fill(rhs), sign_fill(rhs)}
     {
-        if (std::is_signed<T>::value)
-        {
-            if (rhs < 0)
-            {
-                UPPER = uint128_t(-1, -1);
-            }
-        }
     }
 
     template<typename S, typename T,
              typename = typename std::enable_if<std::is_integral<S>::value && std::is_integral<T>::value, void>::type>
-    uint256_t(const S& upper_rhs, const T& lower_rhs)
-#ifdef __BIG_ENDIAN__
-      : UPPER(upper_rhs)
-      , LOWER(lower_rhs)
-#endif
-#ifdef __LITTLE_ENDIAN__
-      : LOWER(lower_rhs)
-      , UPPER(upper_rhs)
-#endif
+    constexpr uint256_t(const S& upper_rhs, const T& lower_rhs)
+      : uint256_t(uint128_t(upper_rhs), uint128_t(lower_rhs))
     {
     }
 
-    uint256_t(const uint128_t& upper_rhs, const uint128_t& lower_rhs)
-#ifdef __BIG_ENDIAN__
-      : UPPER(upper_rhs)
-      , LOWER(lower_rhs)
-#endif
-#ifdef __LITTLE_ENDIAN__
-      : LOWER(lower_rhs)
-      , UPPER(upper_rhs)
-#endif
+    constexpr uint256_t(const uint128_t& upper_rhs, const uint128_t& lower_rhs)
+      : LIMBS{lower_rhs.lower(), lower_rhs.upper(), upper_rhs.lower(), upper_rhs.upper()}
     {
     }
-    uint256_t(const uint128_t& lower_rhs)
-#ifdef __BIG_ENDIAN__
-      : UPPER(uint128_0)
-      , LOWER(lower_rhs)
-#endif
-#ifdef __LITTLE_ENDIAN__
-      : LOWER(lower_rhs)
-      , UPPER(uint128_0)
-#endif
+    constexpr uint256_t(const uint128_t& lower_rhs)
+      : LIMBS{lower_rhs.lower(), lower_rhs.upper(), 0, 0}
     {
     }
 
@@ -140,15 +108,8 @@ class uint256_t
              typename = typename std::enable_if<std::is_integral<R>::value && std::is_integral<S>::value &&
                                                     std::is_integral<T>::value && std::is_integral<U>::value,
                                                 void>::type>
-    uint256_t(const R& upper_lhs, const S& lower_lhs, const T& upper_rhs, const U& lower_rhs)
-#ifdef __BIG_ENDIAN__
-      : UPPER(upper_lhs, lower_lhs)
-      , LOWER(upper_rhs, lower_rhs)
-#endif
-#ifdef __LITTLE_ENDIAN__
-      : LOWER(upper_rhs, lower_rhs)
-      , UPPER(upper_lhs, lower_lhs)
-#endif
+    constexpr uint256_t(const R& upper_lhs, const S& lower_lhs, const T& upper_rhs, const U& lower_rhs)
+      : LIMBS{(uint64_t)lower_rhs, (uint64_t)upper_rhs, (uint64_t)lower_lhs, (uint64_t)upper_lhs}
     {
     }
 
@@ -156,348 +117,1247 @@ class uint256_t
     std::vector<uint8_t> export_bits() const;
     std::vector<uint8_t> export_bits_truncate() const;
 
+    // Fixed size 32-byte images in either byte order, with no allocation.
+    // The pointer overloads read or write exactly 32 bytes
+    constexpr void write_be(uint8_t* out) const;
+    constexpr void write_le(uint8_t* out) const;
+    constexpr void write_be(std::array<uint8_t, 32>& out) const;
+    constexpr void write_le(std::array<uint8_t, 32>& out) const;
+    static constexpr uint256_t read_be(const uint8_t* in);
+    static constexpr uint256_t read_le(const uint8_t* in);
+    static constexpr uint256_t read_be(const std::array<uint8_t, 32>& in);
+    static constexpr uint256_t read_le(const std::array<uint8_t, 32>& in);
+
     // Assignment Operator
     uint256_t& operator=(const uint256_t& rhs) = default;
     uint256_t& operator=(uint256_t&& rhs) = default;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint256_t& operator=(const T& rhs)
+    constexpr uint256_t& operator=(const T& rhs)
     {
-        UPPER = uint128_0;
-
-        if (std::is_signed<T>::value)
-        {
-            if (rhs < 0)
-            {
-                UPPER = uint128_t(-1, -1);
-            }
-        }
-
-        LOWER = rhs;
-        return *this;
+        return *this = uint256_t(rhs);
     }
 
-    uint256_t& operator=(const bool& rhs);
+    constexpr uint256_t& operator=(const bool& rhs);
 
     // Typecast Operators
-    operator bool() const;
-    operator uint8_t() const;
-    operator uint16_t() const;
-    operator uint32_t() const;
-    operator uint64_t() const;
-    operator uint128_t() const;
+    constexpr operator bool() const;
+    constexpr operator uint8_t() const;
+    constexpr operator uint16_t() const;
+    constexpr operator uint32_t() const;
+    constexpr operator uint64_t() const;
+    constexpr operator uint128_t() const;
 
     // Bitwise Operators
-    uint256_t operator&(const uint128_t& rhs) const;
-    uint256_t operator&(const uint256_t& rhs) const;
+    constexpr uint256_t operator&(const uint128_t& rhs) const;
+    constexpr uint256_t operator&(const uint256_t& rhs) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint256_t operator&(const T& rhs) const
+    constexpr uint256_t operator&(const T& rhs) const
     {
-        return uint256_t(uint128_0, LOWER & (uint128_t)rhs);
+        return *this & uint128_t(rhs);
     }
 
-    uint256_t& operator&=(const uint128_t& rhs);
-    uint256_t& operator&=(const uint256_t& rhs);
+    constexpr uint256_t& operator&=(const uint128_t& rhs);
+    constexpr uint256_t& operator&=(const uint256_t& rhs);
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint256_t& operator&=(const T& rhs)
+    constexpr uint256_t& operator&=(const T& rhs)
     {
-        UPPER = uint128_0;
-        LOWER &= rhs;
-        return *this;
+        return *this &= uint128_t(rhs);
     }
 
-    uint256_t operator|(const uint128_t& rhs) const;
-    uint256_t operator|(const uint256_t& rhs) const;
+    constexpr uint256_t operator|(const uint128_t& rhs) const;
+    constexpr uint256_t operator|(const uint256_t& rhs) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint256_t operator|(const T& rhs) const
+    constexpr uint256_t operator|(const T& rhs) const
     {
-        return uint256_t(UPPER, LOWER | uint128_t(rhs));
+        return *this | uint128_t(rhs);
     }
 
-    uint256_t& operator|=(const uint128_t& rhs);
-    uint256_t& operator|=(const uint256_t& rhs);
+    constexpr uint256_t& operator|=(const uint128_t& rhs);
+    constexpr uint256_t& operator|=(const uint256_t& rhs);
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint256_t& operator|=(const T& rhs)
+    constexpr uint256_t& operator|=(const T& rhs)
     {
-        LOWER |= (uint128_t)rhs;
-        return *this;
+        return *this |= uint128_t(rhs);
     }
 
-    uint256_t operator^(const uint128_t& rhs) const;
-    uint256_t operator^(const uint256_t& rhs) const;
+    constexpr uint256_t operator^(const uint128_t& rhs) const;
+    constexpr uint256_t operator^(const uint256_t& rhs) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint256_t operator^(const T& rhs) const
+    constexpr uint256_t operator^(const T& rhs) const
     {
-        return uint256_t(UPPER, LOWER ^ (uint128_t)rhs);
+        return *this ^ uint128_t(rhs);
     }
 
-    uint256_t& operator^=(const uint128_t& rhs);
-    uint256_t& operator^=(const uint256_t& rhs);
+    constexpr uint256_t& operator^=(const uint128_t& rhs);
+    constexpr uint256_t& operator^=(const uint256_t& rhs);
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint256_t& operator^=(const T& rhs)
+    constexpr uint256_t& operator^=(const T& rhs)
     {
-        LOWER ^= (uint128_t)rhs;
-        return *this;
+        return *this ^= uint128_t(rhs);
     }
 
-    uint256_t operator~() const;
+    constexpr uint256_t operator~() const;
 
     // Bit Shift Operators
-    uint256_t operator<<(const uint128_t& shift) const;
-    uint256_t operator<<(const uint256_t& shift) const;
+    // Native shift counts go straight to limb moves and funnel shifts; counts of 256 or more give 0
+    constexpr uint256_t operator<<(const unsigned int shift) const;
+    constexpr uint256_t operator<<(const uint128_t& shift) const;
+    constexpr uint256_t operator<<(const uint256_t& shift) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint256_t operator<<(const T& rhs) const
+    constexpr uint256_t operator<<(const T& rhs) const
     {
-        return *this << uint256_t(rhs);
+        return *this << shift_count(rhs);
     }
 
-    uint256_t& operator<<=(const uint128_t& shift);
-    uint256_t& operator<<=(const uint256_t& shift);
+    constexpr uint256_t& operator<<=(const unsigned int shift);
+    constexpr uint256_t& operator<<=(const uint128_t& shift);
+    constexpr uint256_t& operator<<=(const uint256_t& shift);
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint256_t& operator<<=(const T& rhs)
+    constexpr uint256_t& operator<<=(const T& rhs)
     {
-        *this = *this << uint256_t(rhs);
-        return *this;
+        return *this <<= shift_count(rhs);
     }
 
-    uint256_t operator>>(const uint128_t& shift) const;
-    uint256_t operator>>(const uint256_t& shift) const;
+    constexpr uint256_t operator>>(const unsigned int shift) const;
+    constexpr uint256_t operator>>(const uint128_t& shift) const;
+    constexpr uint256_t operator>>(const uint256_t& shift) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint256_t operator>>(const T& rhs) const
+    constexpr uint256_t operator>>(const T& rhs) const
     {
-        return *this >> uint256_t(rhs);
+        return *this >> shift_count(rhs);
     }
 
-    uint256_t& operator>>=(const uint128_t& shift);
-    uint256_t& operator>>=(const uint256_t& shift);
+    constexpr uint256_t& operator>>=(const unsigned int shift);
+    constexpr uint256_t& operator>>=(const uint128_t& shift);
+    constexpr uint256_t& operator>>=(const uint256_t& shift);
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint256_t& operator>>=(const T& rhs)
+    constexpr uint256_t& operator>>=(const T& rhs)
     {
-        *this = *this >> uint256_t(rhs);
-        return *this;
+        return *this >>= shift_count(rhs);
     }
 
     // Logical Operators
-    bool operator!() const;
+    constexpr bool operator!() const;
 
-    bool operator&&(const uint128_t& rhs) const;
-    bool operator&&(const uint256_t& rhs) const;
+    constexpr bool operator&&(const uint128_t& rhs) const;
+    constexpr bool operator&&(const uint256_t& rhs) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    bool operator&&(const T& rhs) const
+    constexpr bool operator&&(const T& rhs) const
     {
         return ((bool)*this && rhs);
     }
 
-    bool operator||(const uint128_t& rhs) const;
-    bool operator||(const uint256_t& rhs) const;
+    constexpr bool operator||(const uint128_t& rhs) const;
+    constexpr bool operator||(const uint256_t& rhs) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    bool operator||(const T& rhs) const
+    constexpr bool operator||(const T& rhs) const
     {
         return ((bool)*this || rhs);
     }
 
     // Comparison Operators
-    bool operator==(const uint128_t& rhs) const;
-    bool operator==(const uint256_t& rhs) const;
+    constexpr bool operator==(const uint128_t& rhs) const;
+    constexpr bool operator==(const uint256_t& rhs) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    bool operator==(const T& rhs) const
+    constexpr bool operator==(const T& rhs) const
     {
-        return (!UPPER && (LOWER == uint128_t(rhs)));
+        return *this == uint256_t(rhs);
     }
 
-    bool operator!=(const uint128_t& rhs) const;
-    bool operator!=(const uint256_t& rhs) const;
+    constexpr bool operator!=(const uint128_t& rhs) const;
+    constexpr bool operator!=(const uint256_t& rhs) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    bool operator!=(const T& rhs) const
+    constexpr bool operator!=(const T& rhs) const
     {
-        return ((bool)UPPER | (LOWER != uint128_t(rhs)));
+        return *this != uint256_t(rhs);
     }
 
-    bool operator>(const uint128_t& rhs) const;
-    bool operator>(const uint256_t& rhs) const;
+    constexpr bool operator>(const uint128_t& rhs) const;
+    constexpr bool operator>(const uint256_t& rhs) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    bool operator>(const T& rhs) const
+    constexpr bool operator>(const T& rhs) const
     {
-        return ((bool)UPPER | (LOWER > uint128_t(rhs)));
+        return *this > uint256_t(rhs);
     }
 
-    bool operator<(const uint128_t& rhs) const;
-    bool operator<(const uint256_t& rhs) const;
+    constexpr bool operator<(const uint128_t& rhs) const;
+    constexpr bool operator<(const uint256_t& rhs) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    bool operator<(const T& rhs) const
+    constexpr bool operator<(const T& rhs) const
     {
-        return (!UPPER) ? (LOWER < uint128_t(rhs)) : false;
+        return *this < uint256_t(rhs);
     }
 
-    bool operator>=(const uint128_t& rhs) const;
-    bool operator>=(const uint256_t& rhs) const;
+    constexpr bool operator>=(const uint128_t& rhs) const;
+    constexpr bool operator>=(const uint256_t& rhs) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    bool operator>=(const T& rhs) const
+    constexpr bool operator>=(const T& rhs) const
     {
-        return ((*this > rhs) | (*this == rhs));
+        return *this >= uint256_t(rhs);
     }
 
-    bool operator<=(const uint128_t& rhs) const;
-    bool operator<=(const uint256_t& rhs) const;
+    constexpr bool operator<=(const uint128_t& rhs) const;
+    constexpr bool operator<=(const uint256_t& rhs) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    bool operator<=(const T& rhs) const
+    constexpr bool operator<=(const T& rhs) const
     {
-        return ((*this < rhs) | (*this == rhs));
+        return *this <= uint256_t(rhs);
     }
 
     // Arithmetic Operators
-    uint256_t operator+(const uint128_t& rhs) const;
-    uint256_t operator+(const uint256_t& rhs) const;
+    constexpr uint256_t operator+(const uint128_t& rhs) const;
+    constexpr uint256_t operator+(const uint256_t& rhs) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint256_t operator+(const T& rhs) const
+    constexpr uint256_t operator+(const T& rhs) const
     {
-        return uint256_t(UPPER + ((LOWER + (uint128_t)rhs) < LOWER), LOWER + (uint128_t)rhs);
+        return *this + uint256_t(rhs);
     }
 
-    uint256_t& operator+=(const uint128_t& rhs);
-    uint256_t& operator+=(const uint256_t& rhs);
+    constexpr uint256_t& operator+=(const uint128_t& rhs);
+    constexpr uint256_t& operator+=(const uint256_t& rhs);
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint256_t& operator+=(const T& rhs)
+    constexpr uint256_t& operator+=(const T& rhs)
     {
         return *this += uint256_t(rhs);
     }
 
-    uint256_t operator-(const uint128_t& rhs) const;
-    uint256_t operator-(const uint256_t& rhs) const;
+    constexpr uint256_t operator-(const uint128_t& rhs) const;
+    constexpr uint256_t operator-(const uint256_t& rhs) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint256_t operator-(const T& rhs) const
+    constexpr uint256_t operator-(const T& rhs) const
     {
-        return uint256_t(UPPER - ((LOWER - rhs) > LOWER), LOWER - rhs);
+        return *this - uint256_t(rhs);
     }
 
-    uint256_t& operator-=(const uint128_t& rhs);
-    uint256_t& operator-=(const uint256_t& rhs);
+    constexpr uint256_t& operator-=(const uint128_t& rhs);
+    constexpr uint256_t& operator-=(const uint256_t& rhs);
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint256_t& operator-=(const T& rhs)
+    constexpr uint256_t& operator-=(const T& rhs)
     {
         return *this = *this - uint256_t(rhs);
     }
 
-    uint256_t operator*(const uint128_t& rhs) const;
-    uint256_t operator*(const uint256_t& rhs) const;
+    constexpr uint256_t operator*(const uint128_t& rhs) const;
+    constexpr uint256_t operator*(const uint256_t& rhs) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint256_t operator*(const T& rhs) const
+    constexpr uint256_t operator*(const T& rhs) const
     {
-        return *this * uint256_t(rhs);
+        return is_word(rhs) ? mul_word((uint64_t)rhs) : *this * uint256_t(rhs);
     }
 
-    uint256_t& operator*=(const uint128_t& rhs);
-    uint256_t& operator*=(const uint256_t& rhs);
+    constexpr uint256_t& operator*=(const uint128_t& rhs);
+    constexpr uint256_t& operator*=(const uint256_t& rhs);
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint256_t& operator*=(const T& rhs)
+    constexpr uint256_t& operator*=(const T& rhs)
     {
-        return *this = *this * uint256_t(rhs);
+        return *this = *this * rhs;
     }
 
+    // Full 512-bit product, returned as (upper 256 bits, lower 256 bits)
+    constexpr std::pair<uint256_t, uint256_t> mul_wide(const uint256_t& rhs) const;
+
+    // Squares, computing each cross product once and doubling it: 10 of the 16 partial
+    // products for the full width, 6 of the 10 for the truncated square
+    constexpr uint256_t sqr() const;
+    constexpr std::pair<uint256_t, uint256_t> sqr_wide() const;
+
+    // Single limb kernels, one pass over the four limbs
+    constexpr uint256_t mul_word(const uint64_t rhs) const;
+    constexpr std::pair<uint256_t, uint64_t> divmod_word(const uint64_t rhs) const;
+    constexpr uint64_t mod_word(const uint64_t rhs) const;
+
   private:
-    std::pair<uint256_t, uint256_t> divmod(const uint256_t& lhs, const uint256_t& rhs) const;
+    // All ones in the upper limbs when a negative value is widened
+    template<typename T> static constexpr uint64_t sign_fill(const T& rhs)
+    {
+        return (std::is_signed<T>::value && rhs < T(0)) ? ~(uint64_t)0 : 0;
+    }
+
+    // Integers that fit in one limb take the single limb kernels
+    template<typename T> static constexpr bool is_word(const T& rhs)
+    {
+        return (sizeof(T) <= sizeof(uint64_t)) && !(std::is_signed<T>::value && rhs < T(0));
+    }
+
+    // Clamps a shift count to [0, 256]; negative counts shift everything out like counts past the width
+    template<typename T> static constexpr unsigned int shift_count(const T& rhs)
+    {
+        if (std::is_signed<T>::value && rhs < T(0))
+        {
+            return 256;
+        }
+        if (sizeof(T) <= sizeof(uint64_t))
+        {
+            return ((uint64_t)rhs < 256) ? (unsigned int)rhs : 256;
+        }
+        return (uint256_t(rhs) < 256) ? (unsigned int)rhs : 256;
+    }
+
+    // Digits of an integer literal, with any base prefix and digit separators still in place
+    static constexpr uint256_t parse_literal(const char* digits, const std::size_t size);
+    template<char... DIGITS> friend constexpr uint256_t operator""_u256();
+
+    constexpr std::pair<uint256_t, uint256_t> divmod(const uint256_t& lhs, const uint256_t& rhs) const;
     void init(const char* s);
     void init_from_base(const char* s, uint8_t base);
 
   public:
-    uint256_t operator/(const uint128_t& rhs) const;
-    uint256_t operator/(const uint256_t& rhs) const;
+    constexpr uint256_t operator/(const uint128_t& rhs) const;
+    constexpr uint256_t operator/(const uint256_t& rhs) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint256_t operator/(const T& rhs) const
+    constexpr uint256_t operator/(const T& rhs) const
     {
-        return *this / uint256_t(rhs);
+        return is_word(rhs) ? divmod_word((uint64_t)rhs).first : *this / uint256_t(rhs);
     }
 
-    uint256_t& operator/=(const uint128_t& rhs);
-    uint256_t& operator/=(const uint256_t& rhs);
+    constexpr uint256_t& operator/=(const uint128_t& rhs);
+    constexpr uint256_t& operator/=(const uint256_t& rhs);
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint256_t& operator/=(const T& rhs)
+    constexpr uint256_t& operator/=(const T& rhs)
     {
-        return *this = *this / uint256_t(rhs);
+        return *this = *this / rhs;
     }
 
-    uint256_t operator%(const uint128_t& rhs) const;
-    uint256_t operator%(const uint256_t& rhs) const;
+    constexpr uint256_t operator%(const uint128_t& rhs) const;
+    constexpr uint256_t operator%(const uint256_t& rhs) const;
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint256_t operator%(const T& rhs) const
+    constexpr uint256_t operator%(const T& rhs) const
     {
-        return *this % uint256_t(rhs);
+        return is_word(rhs) ? uint256_t(mod_word((uint64_t)rhs)) : *this % uint256_t(rhs);
     }
 
-    uint256_t& operator%=(const uint128_t& rhs);
-    uint256_t& operator%=(const uint256_t& rhs);
+    constexpr uint256_t& operator%=(const uint128_t& rhs);
+    constexpr uint256_t& operator%=(const uint256_t& rhs);
 
     template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-    uint256_t& operator%=(const T& rhs)
+    constexpr uint256_t& operator%=(const T& rhs)
     {
-        return *this = *this % uint256_t(rhs);
+        return *this = *this % rhs;
     }
 
     // Increment Operators
-    uint256_t& operator++();
-    uint256_t operator++(int);
+    constexpr uint256_t& operator++();
+    constexpr uint256_t operator++(int);
 
     // Decrement Operators
-    uint256_t& operator--();
-    uint256_t operator--(int);
+    constexpr uint256_t& operator--();
+    constexpr uint256_t operator--(int);
 
     // Nothing done since promotion doesn't work here
-    uint256_t operator+() const;
+    constexpr uint256_t operator+() const;
 
     // two's complement
-    uint256_t operator-() const;
+    constexpr uint256_t operator-() const;
 
     // Get private values
-    const uint128_t& upper() const;
-    const uint128_t& lower() const;
+    constexpr uint128_t upper() const;
+    constexpr uint128_t lower() const;
+
+    // 64-bit limb by index, 0 being the least significant
+    constexpr uint64_t limb(const unsigned int index) const;
 
     // Get bitsize of value
-    uint16_t bits() const;
+    constexpr uint16_t bits() const;
+
+    // Bit queries, each a handful of bit scan instructions over the four limbs.
+    // Zero has 256 leading and 256 trailing zeros.
+    constexpr unsigned int leading_zeros() const;
+    constexpr unsigned int trailing_zeros() const;
+    constexpr unsigned int popcount() const;
+    constexpr bool test_bit(const unsigned int bit) const;
+
+    // The width (at most 64) bits starting at bit offset; bits past the top read as zero
+    constexpr uint64_t bit_window(const unsigned int offset, const unsigned int width) const;
 
     // Get string representation of value
     std::string str(uint8_t base = 10, const unsigned int& len = 0) const;
 };
 
 // useful values
-UINT256_T_EXTERN extern const uint128_t uint128_64;
-UINT256_T_EXTERN extern const uint128_t uint128_128;
-UINT256_T_EXTERN extern const uint128_t uint128_256;
-UINT256_T_EXTERN extern const uint256_t uint256_0;
-UINT256_T_EXTERN extern const uint256_t uint256_1;
-UINT256_T_EXTERN extern const uint256_t uint256_max;
+inline constexpr uint128_t uint128_64(64);
+inline constexpr uint128_t uint128_128(128);
+inline constexpr uint128_t uint128_256(256);
+inline constexpr uint256_t uint256_0(0);
+inline constexpr uint256_t uint256_1(1);
+inline constexpr uint256_t uint256_max(~(uint64_t)0, ~(uint64_t)0, ~(uint64_t)0, ~(uint64_t)0);
+
+// Everything usable in constant expressions is defined inline below
+
+constexpr uint256_t::uint256_t(const bool& b)
+  : uint256_t((uint8_t)b)
+{
+}
+
+constexpr uint256_t& uint256_t::operator=(const bool& rhs)
+{
+    LIMBS[0] = rhs;
+    LIMBS[1] = LIMBS[2] = LIMBS[3] = 0;
+    return *this;
+}
+
+constexpr uint256_t::operator bool() const
+{
+    return (bool)(LIMBS[0] | LIMBS[1] | LIMBS[2] | LIMBS[3]);
+}
+
+constexpr uint256_t::operator uint8_t() const
+{
+    return (uint8_t)LIMBS[0];
+}
+
+constexpr uint256_t::operator uint16_t() const
+{
+    return (uint16_t)LIMBS[0];
+}
+
+constexpr uint256_t::operator uint32_t() const
+{
+    return (uint32_t)LIMBS[0];
+}
+
+constexpr uint256_t::operator uint64_t() const
+{
+    return (uint64_t)LIMBS[0];
+}
+
+constexpr uint256_t::operator uint128_t() const
+{
+    return lower();
+}
+
+constexpr uint256_t uint256_t::operator&(const uint128_t& rhs) const
+{
+    return uint256_t(lower() & rhs);
+}
+
+constexpr uint256_t uint256_t::operator&(const uint256_t& rhs) const
+{
+    uint256_t out;
+    for (int i = 0; i < 4; i++)
+    {
+        out.LIMBS[i] = LIMBS[i] & rhs.LIMBS[i];
+    }
+    return out;
+}
+
+constexpr uint256_t& uint256_t::operator&=(const uint128_t& rhs)
+{
+    LIMBS[0] &= rhs.lower();
+    LIMBS[1] &= rhs.upper();
+    LIMBS[2] = LIMBS[3] = 0;
+    return *this;
+}
+
+constexpr uint256_t& uint256_t::operator&=(const uint256_t& rhs)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        LIMBS[i] &= rhs.LIMBS[i];
+    }
+    return *this;
+}
+
+constexpr uint256_t uint256_t::operator|(const uint128_t& rhs) const
+{
+    return uint256_t(upper(), lower() | rhs);
+}
+
+constexpr uint256_t uint256_t::operator|(const uint256_t& rhs) const
+{
+    uint256_t out;
+    for (int i = 0; i < 4; i++)
+    {
+        out.LIMBS[i] = LIMBS[i] | rhs.LIMBS[i];
+    }
+    return out;
+}
+
+constexpr uint256_t& uint256_t::operator|=(const uint128_t& rhs)
+{
+    LIMBS[0] |= rhs.lower();
+    LIMBS[1] |= rhs.upper();
+    return *this;
+}
+
+constexpr uint256_t& uint256_t::operator|=(const uint256_t& rhs)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        LIMBS[i] |= rhs.LIMBS[i];
+    }
+    return *this;
+}
+
+constexpr uint256_t uint256_t::operator^(const uint128_t& rhs) const
+{
+    return uint256_t(upper(), lower() ^ rhs);
+}
+
+constexpr uint256_t uint256_t::operator^(const uint256_t& rhs) const
+{
+    uint256_t out;
+    for (int i = 0; i < 4; i++)
+    {
+        out.LIMBS[i] = LIMBS[i] ^ rhs.LIMBS[i];
+    }
+    return out;
+}
+
+constexpr uint256_t& uint256_t::operator^=(const uint128_t& rhs)
+{
+    LIMBS[0] ^= rhs.lower();
+    LIMBS[1] ^= rhs.upper();
+    return *this;
+}
+
+constexpr uint256_t& uint256_t::operator^=(const uint256_t& rhs)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        LIMBS[i] ^= rhs.LIMBS[i];
+    }
+    return *this;
+}
+
+constexpr uint256_t uint256_t::operator~() const
+{
+    return uint256_t(~LIMBS[3], ~LIMBS[2], ~LIMBS[1], ~LIMBS[0]);
+}
+
+constexpr uint256_t uint256_t::operator<<(const unsigned int shift) const
+{
+    if (shift >= 256)
+    {
+        return uint256_0;
+    }
+
+    // Move whole limbs first, then funnel the remaining bits across limb boundaries
+    const unsigned int limbs = shift / 64;
+    const unsigned int bits = shift % 64;
+    uint256_t out(uint256_0);
+    for (int i = 3; i >= (int)limbs; i--)
+    {
+        const uint64_t low = (i > (int)limbs) ? LIMBS[i - limbs - 1] : 0;
+        out.LIMBS[i] = uint256_limbs::shld(LIMBS[i - limbs], low, bits);
+    }
+    return out;
+}
+
+constexpr uint256_t uint256_t::operator<<(const uint128_t& rhs) const
+{
+    return *this << uint256_t(rhs);
+}
+
+constexpr uint256_t uint256_t::operator<<(const uint256_t& rhs) const
+{
+    if ((rhs.LIMBS[3] | rhs.LIMBS[2] | rhs.LIMBS[1]) || (rhs.LIMBS[0] >= 256))
+    {
+        return uint256_0;
+    }
+    return *this << (unsigned int)rhs.LIMBS[0];
+}
+
+constexpr uint256_t& uint256_t::operator<<=(const unsigned int shift)
+{
+    *this = *this << shift;
+    return *this;
+}
+
+constexpr uint256_t& uint256_t::operator<<=(const uint128_t& shift)
+{
+    return *this <<= uint256_t(shift);
+}
+
+constexpr uint256_t& uint256_t::operator<<=(const uint256_t& shift)
+{
+    *this = *this << shift;
+    return *this;
+}
+
+constexpr uint256_t uint256_t::operator>>(const unsigned int shift) const
+{
+    if (shift >= 256)
+    {
+        return uint256_0;
+    }
+
+    // Move whole limbs first, then funnel the remaining bits across limb boundaries
+    const unsigned int limbs = shift / 64;
+    const unsigned int bits = shift % 64;
+    uint256_t out(uint256_0);
+    for (unsigned int i = 0; i + limbs < 4; i++)
+    {
+        const uint64_t high = (i + limbs + 1 < 4) ? LIMBS[i + limbs + 1] : 0;
+        out.LIMBS[i] = uint256_limbs::shrd(high, LIMBS[i + limbs], bits);
+    }
+    return out;
+}
+
+constexpr uint256_t uint256_t::operator>>(const uint128_t& rhs) const
+{
+    return *this >> uint256_t(rhs);
+}
+
+constexpr uint256_t uint256_t::operator>>(const uint256_t& rhs) const
+{
+    if ((rhs.LIMBS[3] | rhs.LIMBS[2] | rhs.LIMBS[1]) || (rhs.LIMBS[0] >= 256))
+    {
+        return uint256_0;
+    }
+    return *this >> (unsigned int)rhs.LIMBS[0];
+}
+
+constexpr uint256_t& uint256_t::operator>>=(const unsigned int shift)
+{
+    *this = *this >> shift;
+    return *this;
+}
+
+constexpr uint256_t& uint256_t::operator>>=(const uint128_t& shift)
+{
+    return *this >>= uint256_t(shift);
+}
+
+constexpr uint256_t& uint256_t::operator>>=(const uint256_t& shift)
+{
+    *this = *this >> shift;
+    return *this;
+}
+
+constexpr bool uint256_t::operator!() const
+{
+    return !(bool)*this;
+}
+
+constexpr bool uint256_t::operator&&(const uint128_t& rhs) const
+{
+    return (*this && uint256_t(rhs));
+}
+
+constexpr bool uint256_t::operator&&(const uint256_t& rhs) const
+{
+    return ((bool)*this && (bool)rhs);
+}
+
+constexpr bool uint256_t::operator||(const uint128_t& rhs) const
+{
+    return (*this || uint256_t(rhs));
+}
+
+constexpr bool uint256_t::operator||(const uint256_t& rhs) const
+{
+    return ((bool)*this || (bool)rhs);
+}
+
+constexpr bool uint256_t::operator==(const uint128_t& rhs) const
+{
+    return (*this == uint256_t(rhs));
+}
+
+constexpr bool uint256_t::operator==(const uint256_t& rhs) const
+{
+    return !((LIMBS[0] ^ rhs.LIMBS[0]) | (LIMBS[1] ^ rhs.LIMBS[1]) | (LIMBS[2] ^ rhs.LIMBS[2]) |
+             (LIMBS[3] ^ rhs.LIMBS[3]));
+}
+
+constexpr bool uint256_t::operator!=(const uint128_t& rhs) const
+{
+    return (*this != uint256_t(rhs));
+}
+
+constexpr bool uint256_t::operator!=(const uint256_t& rhs) const
+{
+    return !(*this == rhs);
+}
+
+constexpr bool uint256_t::operator>(const uint128_t& rhs) const
+{
+    return (*this > uint256_t(rhs));
+}
+
+constexpr bool uint256_t::operator>(const uint256_t& rhs) const
+{
+    return rhs < *this;
+}
+
+constexpr bool uint256_t::operator<(const uint128_t& rhs) const
+{
+    return (*this < uint256_t(rhs));
+}
+
+constexpr bool uint256_t::operator<(const uint256_t& rhs) const
+{
+    // The borrow out of lhs - rhs is set exactly when lhs < rhs
+    uint64_t borrow = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        uint256_limbs::subb(LIMBS[i], rhs.LIMBS[i], borrow, borrow);
+    }
+    return borrow;
+}
+
+constexpr bool uint256_t::operator>=(const uint128_t& rhs) const
+{
+    return (*this >= uint256_t(rhs));
+}
+
+constexpr bool uint256_t::operator>=(const uint256_t& rhs) const
+{
+    return !(*this < rhs);
+}
+
+constexpr bool uint256_t::operator<=(const uint128_t& rhs) const
+{
+    return (*this <= uint256_t(rhs));
+}
+
+constexpr bool uint256_t::operator<=(const uint256_t& rhs) const
+{
+    return !(rhs < *this);
+}
+
+constexpr uint256_t uint256_t::operator+(const uint128_t& rhs) const
+{
+    return *this + uint256_t(rhs);
+}
+
+constexpr uint256_t uint256_t::operator+(const uint256_t& rhs) const
+{
+    uint256_t out;
+    uint64_t carry = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        out.LIMBS[i] = uint256_limbs::addc(LIMBS[i], rhs.LIMBS[i], carry, carry);
+    }
+    return out;
+}
+
+constexpr uint256_t& uint256_t::operator+=(const uint128_t& rhs)
+{
+    return *this += uint256_t(rhs);
+}
+
+constexpr uint256_t& uint256_t::operator+=(const uint256_t& rhs)
+{
+    uint64_t carry = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        LIMBS[i] = uint256_limbs::addc(LIMBS[i], rhs.LIMBS[i], carry, carry);
+    }
+    return *this;
+}
+
+constexpr uint256_t uint256_t::operator-(const uint128_t& rhs) const
+{
+    return *this - uint256_t(rhs);
+}
+
+constexpr uint256_t uint256_t::operator-(const uint256_t& rhs) const
+{
+    uint256_t out;
+    uint64_t borrow = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        out.LIMBS[i] = uint256_limbs::subb(LIMBS[i], rhs.LIMBS[i], borrow, borrow);
+    }
+    return out;
+}
+
+constexpr uint256_t& uint256_t::operator-=(const uint128_t& rhs)
+{
+    return *this -= uint256_t(rhs);
+}
+
+constexpr uint256_t& uint256_t::operator-=(const uint256_t& rhs)
+{
+    uint64_t borrow = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        LIMBS[i] = uint256_limbs::subb(LIMBS[i], rhs.LIMBS[i], borrow, borrow);
+    }
+    return *this;
+}
+
+constexpr uint256_t uint256_t::operator*(const uint128_t& rhs) const
+{
+    return *this * uint256_t(rhs);
+}
+
+constexpr uint256_t uint256_t::operator*(const uint256_t& rhs) const
+{
+    // Schoolbook multiplication, keeping only the partial products that land in the low 256 bits
+    uint256_t out(uint256_0);
+    for (int i = 0; i < 4; i++)
+    {
+        uint64_t carry = 0;
+        for (int j = 0; i + j < 4; j++)
+        {
+            uint64_t high = 0;
+            const uint64_t low = uint256_limbs::mul(LIMBS[i], rhs.LIMBS[j], high);
+            uint64_t c1 = 0, c2 = 0;
+            out.LIMBS[i + j] = uint256_limbs::addc(out.LIMBS[i + j], low, 0, c1);
+            out.LIMBS[i + j] = uint256_limbs::addc(out.LIMBS[i + j], carry, 0, c2);
+            carry = high + c1 + c2;
+        }
+    }
+    return out;
+}
+
+constexpr std::pair<uint256_t, uint256_t> uint256_t::mul_wide(const uint256_t& rhs) const
+{
+    // Schoolbook multiplication over all 16 partial products, one carry chain per row
+    uint64_t product[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    for (int i = 0; i < 4; i++)
+    {
+        uint64_t carry = 0;
+        for (int j = 0; j < 4; j++)
+        {
+            uint64_t high = 0;
+            const uint64_t low = uint256_limbs::mul(LIMBS[i], rhs.LIMBS[j], high);
+            uint64_t c1 = 0, c2 = 0;
+            product[i + j] = uint256_limbs::addc(product[i + j], low, 0, c1);
+            product[i + j] = uint256_limbs::addc(product[i + j], carry, 0, c2);
+            carry = high + c1 + c2;
+        }
+        product[i + 4] = carry;
+    }
+    return std::pair<uint256_t, uint256_t>(uint256_t(product[7], product[6], product[5], product[4]),
+                                           uint256_t(product[3], product[2], product[1], product[0]));
+}
+
+constexpr uint256_t uint256_t::sqr() const
+{
+    // Cross products landing in the low 256 bits: a0a1, a0a2, a0a3 and a1a2
+    uint64_t t[4] = {0, 0, 0, 0};
+    for (int i = 0; i < 2; i++)
+    {
+        uint64_t carry = 0;
+        for (int j = i + 1; i + j < 4; j++)
+        {
+            uint64_t high = 0;
+            const uint64_t low = uint256_limbs::mul(LIMBS[i], LIMBS[j], high);
+            uint64_t c1 = 0, c2 = 0;
+            t[i + j] = uint256_limbs::addc(t[i + j], low, 0, c1);
+            t[i + j] = uint256_limbs::addc(t[i + j], carry, 0, c2);
+            carry = high + c1 + c2;
+        }
+    }
+
+    // Doubled, plus the squares on the diagonal
+    uint256_t out(uint256_limbs::shld(t[3], t[2], 1), uint256_limbs::shld(t[2], t[1], 1), t[1] << 1, 0);
+    uint64_t high0 = 0, high1 = 0, carry = 0;
+    const uint64_t low0 = uint256_limbs::mul(LIMBS[0], LIMBS[0], high0);
+    const uint64_t low1 = uint256_limbs::mul(LIMBS[1], LIMBS[1], high1);
+    out.LIMBS[0] = low0;
+    out.LIMBS[1] = uint256_limbs::addc(out.LIMBS[1], high0, 0, carry);
+    out.LIMBS[2] = uint256_limbs::addc(out.LIMBS[2], low1, carry, carry);
+    out.LIMBS[3] = uint256_limbs::addc(out.LIMBS[3], high1, carry, carry);
+    return out;
+}
+
+constexpr std::pair<uint256_t, uint256_t> uint256_t::sqr_wide() const
+{
+    // Each cross product a[i] * a[j] appears twice in the square, so compute it once and double
+    uint64_t t[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    for (int i = 0; i < 3; i++)
+    {
+        uint64_t carry = 0;
+        for (int j = i + 1; j < 4; j++)
+        {
+            uint64_t high = 0;
+            const uint64_t low = uint256_limbs::mul(LIMBS[i], LIMBS[j], high);
+            uint64_t c1 = 0, c2 = 0;
+            t[i + j] = uint256_limbs::addc(t[i + j], low, 0, c1);
+            t[i + j] = uint256_limbs::addc(t[i + j], carry, 0, c2);
+            carry = high + c1 + c2;
+        }
+        t[i + 4] = carry;
+    }
+    t[7] = t[6] >> 63;
+    for (int i = 6; i > 0; i--)
+    {
+        t[i] = uint256_limbs::shld(t[i], t[i - 1], 1);
+    }
+    t[0] <<= 1;
+
+    // Then add the squares on the diagonal
+    uint64_t carry = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        uint64_t high = 0;
+        const uint64_t low = uint256_limbs::mul(LIMBS[i], LIMBS[i], high);
+        t[2 * i] = uint256_limbs::addc(t[2 * i], low, carry, carry);
+        t[2 * i + 1] = uint256_limbs::addc(t[2 * i + 1], high, carry, carry);
+    }
+    return std::pair<uint256_t, uint256_t>(uint256_t(t[7], t[6], t[5], t[4]), uint256_t(t[3], t[2], t[1], t[0]));
+}
+
+constexpr uint256_t uint256_t::mul_word(const uint64_t rhs) const
+{
+    uint256_t out;
+    uint64_t carry = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        uint64_t high = 0;
+        uint64_t c = 0;
+        out.LIMBS[i] = uint256_limbs::addc(uint256_limbs::mul(LIMBS[i], rhs, high), carry, 0, c);
+        carry = high + c;
+    }
+    return out;
+}
+
+constexpr uint256_t& uint256_t::operator*=(const uint128_t& rhs)
+{
+    return *this *= uint256_t(rhs);
+}
+
+constexpr uint256_t& uint256_t::operator*=(const uint256_t& rhs)
+{
+    *this = *this * rhs;
+    return *this;
+}
+
+constexpr std::pair<uint256_t, uint256_t> uint256_t::divmod(const uint256_t& lhs, const uint256_t& rhs) const
+{
+    // Save some calculations /////////////////////
+    if (rhs == uint256_0)
+    {
+        throw std::domain_error("Error: division or modulus by 0");
+    }
+    else if (rhs == uint256_1)
+    {
+        return std::pair<uint256_t, uint256_t>(lhs, uint256_0);
+    }
+    else if (lhs == rhs)
+    {
+        return std::pair<uint256_t, uint256_t>(uint256_1, uint256_0);
+    }
+    else if ((lhs == uint256_0) || (lhs < rhs))
+    {
+        return std::pair<uint256_t, uint256_t>(uint256_0, lhs);
+    }
+
+    std::pair<uint256_t, uint256_t> qr(uint256_0, uint256_0);
+    uint256_limbs::divmod<4>(lhs.LIMBS, uint256_limbs::significant(lhs.LIMBS, 4), rhs.LIMBS,
+                             uint256_limbs::significant(rhs.LIMBS, 4), qr.first.LIMBS, qr.second.LIMBS);
+    return qr;
+}
+
+constexpr std::pair<uint256_t, uint64_t> uint256_t::divmod_word(const uint64_t rhs) const
+{
+    if (rhs == 0)
+    {
+        throw std::domain_error("Error: division or modulus by 0");
+    }
+
+    // The running remainder is always below rhs, so each step is a single 128/64-bit division
+    std::pair<uint256_t, uint64_t> qr(uint256_0, 0);
+    for (int i = 3; i >= 0; i--)
+    {
+        qr.first.LIMBS[i] = uint256_limbs::div(qr.second, LIMBS[i], rhs, qr.second);
+    }
+    return qr;
+}
+
+constexpr uint64_t uint256_t::mod_word(const uint64_t rhs) const
+{
+    if (rhs == 0)
+    {
+        throw std::domain_error("Error: division or modulus by 0");
+    }
+
+    uint64_t remainder = 0;
+    for (int i = 3; i >= 0; i--)
+    {
+        uint256_limbs::div(remainder, LIMBS[i], rhs, remainder);
+    }
+    return remainder;
+}
+
+constexpr uint256_t uint256_t::operator/(const uint128_t& rhs) const
+{
+    return *this / uint256_t(rhs);
+}
+
+constexpr uint256_t uint256_t::operator/(const uint256_t& rhs) const
+{
+    return divmod(*this, rhs).first;
+}
+
+constexpr uint256_t& uint256_t::operator/=(const uint128_t& rhs)
+{
+    return *this /= uint256_t(rhs);
+}
+
+constexpr uint256_t& uint256_t::operator/=(const uint256_t& rhs)
+{
+    *this = *this / rhs;
+    return *this;
+}
+
+constexpr uint256_t uint256_t::operator%(const uint128_t& rhs) const
+{
+    return *this % uint256_t(rhs);
+}
+
+constexpr uint256_t uint256_t::operator%(const uint256_t& rhs) const
+{
+    return divmod(*this, rhs).second;
+}
+
+constexpr uint256_t& uint256_t::operator%=(const uint128_t& rhs)
+{
+    return *this %= uint256_t(rhs);
+}
+
+constexpr uint256_t& uint256_t::operator%=(const uint256_t& rhs)
+{
+    *this = *this % rhs;
+    return *this;
+}
+
+constexpr uint256_t& uint256_t::operator++()
+{
+    uint64_t carry = 1;
+    for (int i = 0; i < 4; i++)
+    {
+        LIMBS[i] = uint256_limbs::addc(LIMBS[i], 0, carry, carry);
+    }
+    return *this;
+}
+
+constexpr uint256_t uint256_t::operator++(int)
+{
+    uint256_t temp(*this);
+    ++*this;
+    return temp;
+}
+
+constexpr uint256_t& uint256_t::operator--()
+{
+    uint64_t borrow = 1;
+    for (int i = 0; i < 4; i++)
+    {
+        LIMBS[i] = uint256_limbs::subb(LIMBS[i], 0, borrow, borrow);
+    }
+    return *this;
+}
+
+constexpr uint256_t uint256_t::operator--(int)
+{
+    uint256_t temp(*this);
+    --*this;
+    return temp;
+}
+
+constexpr uint256_t uint256_t::operator+() const
+{
+    return *this;
+}
+
+constexpr uint256_t uint256_t::operator-() const
+{
+    return ~*this + uint256_1;
+}
+
+constexpr uint128_t uint256_t::upper() const
+{
+    return uint128_t(LIMBS[3], LIMBS[2]);
+}
+
+constexpr uint128_t uint256_t::lower() const
+{
+    return uint128_t(LIMBS[1], LIMBS[0]);
+}
+
+constexpr uint64_t uint256_t::limb(const unsigned int index) const
+{
+    return LIMBS[index];
+}
+
+constexpr void uint256_t::write_be(uint8_t* out) const
+{
+    for (int i = 0; i < 4; i++)
+    {
+        uint256_limbs::store_be(out + 8 * i, LIMBS[3 - i]);
+    }
+}
+
+constexpr void uint256_t::write_le(uint8_t* out) const
+{
+    for (int i = 0; i < 4; i++)
+    {
+        uint256_limbs::store_le(out + 8 * i, LIMBS[i]);
+    }
+}
+
+constexpr void uint256_t::write_be(std::array<uint8_t, 32>& out) const
+{
+    write_be(out.data());
+}
+
+constexpr void uint256_t::write_le(std::array<uint8_t, 32>& out) const
+{
+    write_le(out.data());
+}
+
+constexpr uint256_t uint256_t::read_be(const uint8_t* in)
+{
+    return uint256_t(uint256_limbs::load_be(in), uint256_limbs::load_be(in + 8), uint256_limbs::load_be(in + 16),
+                     uint256_limbs::load_be(in + 24));
+}
+
+constexpr uint256_t uint256_t::read_le(const uint8_t* in)
+{
+    return uint256_t(uint256_limbs::load_le(in + 24), uint256_limbs::load_le(in + 16), uint256_limbs::load_le(in + 8),
+                     uint256_limbs::load_le(in));
+}
+
+constexpr uint256_t uint256_t::read_be(const std::array<uint8_t, 32>& in)
+{
+    return read_be(in.data());
+}
+
+constexpr uint256_t uint256_t::read_le(const std::array<uint8_t, 32>& in)
+{
+    return read_le(in.data());
+}
+
+constexpr uint16_t uint256_t::bits() const
+{
+    return 256 - leading_zeros();
+}
+
+constexpr unsigned int uint256_t::leading_zeros() const
+{
+    for (int i = 3; i >= 0; i--)
+    {
+        if (LIMBS[i])
+        {
+            return 64 * (3 - i) + uint256_limbs::clz(LIMBS[i]);
+        }
+    }
+    return 256;
+}
+
+constexpr unsigned int uint256_t::trailing_zeros() const
+{
+    for (int i = 0; i < 4; i++)
+    {
+        if (LIMBS[i])
+        {
+            return 64 * i + uint256_limbs::ctz(LIMBS[i]);
+        }
+    }
+    return 256;
+}
+
+constexpr unsigned int uint256_t::popcount() const
+{
+    return uint256_limbs::popcount(LIMBS[0]) + uint256_limbs::popcount(LIMBS[1]) +
+           uint256_limbs::popcount(LIMBS[2]) + uint256_limbs::popcount(LIMBS[3]);
+}
+
+constexpr bool uint256_t::test_bit(const unsigned int bit) const
+{
+    return (bit < 256) && ((LIMBS[bit / 64] >> (bit % 64)) & 1);
+}
+
+constexpr uint64_t uint256_t::bit_window(const unsigned int offset, const unsigned int width) const
+{
+    if ((offset >= 256) || (width == 0))
+    {
+        return 0;
+    }
+
+    // The window spans at most two limbs
+    const unsigned int limb = offset / 64;
+    const unsigned int shift = offset % 64;
+    const uint64_t high = (limb < 3) ? LIMBS[limb + 1] : 0;
+    const uint64_t window = uint256_limbs::shrd(high, LIMBS[limb], shift);
+    return (width >= 64) ? window : window & ((((uint64_t)1) << width) - 1);
+}
+
+constexpr uint256_t uint256_t::parse_literal(const char* digits, const std::size_t size)
+{
+    uint64_t base = 10;
+    std::size_t i = 0;
+    if ((size > 1) && (digits[0] == '0'))
+    {
+        if ((digits[1] == 'x') || (digits[1] == 'X'))
+        {
+            base = 16;
+            i = 2;
+        }
+        else if ((digits[1] == 'b') || (digits[1] == 'B'))
+        {
+            base = 2;
+            i = 2;
+        }
+        else
+        {
+            base = 8;
+            i = 1;
+        }
+    }
+
+    // The compiler has already checked that every digit is valid for the base
+    uint256_t out;
+    for (; i < size; i++)
+    {
+        const char c = digits[i];
+        if (c == '\'')
+        {
+            continue;
+        }
+        uint64_t carry = (c >= 'a') ? (c - 'a' + 10) : (c >= 'A') ? (c - 'A' + 10) : (c - '0');
+        for (int j = 0; j < 4; j++)
+        {
+            uint64_t high = 0, c1 = 0;
+            out.LIMBS[j] = uint256_limbs::addc(uint256_limbs::mul(out.LIMBS[j], base, high), carry, 0, c1);
+            carry = high + c1;
+        }
+        if (carry)
+        {
+            throw std::out_of_range("Error: uint256_t literal does not fit in 256 bits");
+        }
+    }
+    return out;
+}
 
 // Bitwise Operators
 UINT256_T_EXTERN uint256_t operator&(const uint128_t& lhs, const uint256_t& rhs);
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-uint256_t operator&(const T& lhs, const uint256_t& rhs)
+constexpr uint256_t operator&(const T& lhs, const uint256_t& rhs)
 {
     return rhs & lhs;
 }
@@ -505,7 +1365,7 @@ uint256_t operator&(const T& lhs, const uint256_t& rhs)
 UINT256_T_EXTERN uint128_t& operator&=(uint128_t& lhs, const uint256_t& rhs);
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-T& operator&=(T& lhs, const uint256_t& rhs)
+constexpr T& operator&=(T& lhs, const uint256_t& rhs)
 {
     return lhs = static_cast<T>(rhs & lhs);
 }
@@ -513,7 +1373,7 @@ T& operator&=(T& lhs, const uint256_t& rhs)
 UINT256_T_EXTERN uint256_t operator|(const uint128_t& lhs, const uint256_t& rhs);
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-uint256_t operator|(const T& lhs, const uint256_t& rhs)
+constexpr uint256_t operator|(const T& lhs, const uint256_t& rhs)
 {
     return rhs | lhs;
 }
@@ -521,7 +1381,7 @@ uint256_t operator|(const T& lhs, const uint256_t& rhs)
 UINT256_T_EXTERN uint128_t& operator|=(uint128_t& lhs, const uint256_t& rhs);
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-T& operator|=(T& lhs, const uint256_t& rhs)
+constexpr T& operator|=(T& lhs, const uint256_t& rhs)
 {
     return lhs = static_cast<T>(rhs | lhs);
 }
@@ -529,7 +1389,7 @@ T& operator|=(T& lhs, const uint256_t& rhs)
 UINT256_T_EXTERN uint256_t operator^(const uint128_t& lhs, const uint256_t& rhs);
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-uint256_t operator^(const T& lhs, const uint256_t& rhs)
+constexpr uint256_t operator^(const T& lhs, const uint256_t& rhs)
 {
     return rhs ^ lhs;
 }
@@ -537,7 +1397,7 @@ uint256_t operator^(const T& lhs, const uint256_t& rhs)
 uint128_t& operator^=(uint128_t& lhs, const uint256_t& rhs);
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-T& operator^=(T& lhs, const uint256_t& rhs)
+constexpr T& operator^=(T& lhs, const uint256_t& rhs)
 {
     return lhs = static_cast<T>(rhs ^ lhs);
 }
@@ -557,7 +1417,7 @@ UINT256_T_EXTERN uint256_t operator<<(const int64_t& lhs, const uint256_t& rhs);
 UINT256_T_EXTERN uint128_t& operator<<=(uint128_t& lhs, const uint256_t& rhs);
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-T& operator<<=(T& lhs, const uint256_t& rhs)
+constexpr T& operator<<=(T& lhs, const uint256_t& rhs)
 {
     lhs = static_cast<T>(uint256_t(lhs) << rhs);
     return lhs;
@@ -577,7 +1437,7 @@ UINT256_T_EXTERN uint256_t operator>>(const int64_t& lhs, const uint256_t& rhs);
 UINT256_T_EXTERN uint128_t& operator>>=(uint128_t& lhs, const uint256_t& rhs);
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-T& operator>>=(T& lhs, const uint256_t& rhs)
+constexpr T& operator>>=(T& lhs, const uint256_t& rhs)
 {
     return lhs = static_cast<T>(uint256_t(lhs) >> rhs);
 }
@@ -586,7 +1446,7 @@ T& operator>>=(T& lhs, const uint256_t& rhs)
 UINT256_T_EXTERN bool operator==(const uint128_t& lhs, const uint256_t& rhs);
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-bool operator==(const T& lhs, const uint256_t& rhs)
+constexpr bool operator==(const T& lhs, const uint256_t& rhs)
 {
     return (!rhs.upper() && ((uint64_t)lhs == rhs.lower()));
 }
@@ -594,7 +1454,7 @@ bool operator==(const T& lhs, const uint256_t& rhs)
 UINT256_T_EXTERN bool operator!=(const uint128_t& lhs, const uint256_t& rhs);
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-bool operator!=(const T& lhs, const uint256_t& rhs)
+constexpr bool operator!=(const T& lhs, const uint256_t& rhs)
 {
     return (rhs.upper() | ((uint64_t)lhs != rhs.lower()));
 }
@@ -602,7 +1462,7 @@ bool operator!=(const T& lhs, const uint256_t& rhs)
 UINT256_T_EXTERN bool operator>(const uint128_t& lhs, const uint256_t& rhs);
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-bool operator>(const T& lhs, const uint256_t& rhs)
+constexpr bool operator>(const T& lhs, const uint256_t& rhs)
 {
     return rhs.upper() ? false : ((uint128_t)lhs > rhs.lower());
 }
@@ -610,7 +1470,7 @@ bool operator>(const T& lhs, const uint256_t& rhs)
 UINT256_T_EXTERN bool operator<(const uint128_t& lhs, const uint256_t& rhs);
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-bool operator<(const T& lhs, const uint256_t& rhs)
+constexpr bool operator<(const T& lhs, const uint256_t& rhs)
 {
     return rhs.upper() ? true : ((uint128_t)lhs < rhs.lower());
 }
@@ -618,7 +1478,7 @@ bool operator<(const T& lhs, const uint256_t& rhs)
 UINT256_T_EXTERN bool operator>=(const uint128_t& lhs, const uint256_t& rhs);
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-bool operator>=(const T& lhs, const uint256_t& rhs)
+constexpr bool operator>=(const T& lhs, const uint256_t& rhs)
 {
     return rhs.upper() ? false : ((uint128_t)lhs >= rhs.lower());
 }
@@ -626,7 +1486,7 @@ bool operator>=(const T& lhs, const uint256_t& rhs)
 UINT256_T_EXTERN bool operator<=(const uint128_t& lhs, const uint256_t& rhs);
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-bool operator<=(const T& lhs, const uint256_t& rhs)
+constexpr bool operator<=(const T& lhs, const uint256_t& rhs)
 {
     return rhs.upper() ? true : ((uint128_t)lhs <= rhs.lower());
 }
@@ -635,7 +1495,7 @@ bool operator<=(const T& lhs, const uint256_t& rhs)
 UINT256_T_EXTERN uint256_t operator+(const uint128_t& lhs, const uint256_t& rhs);
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-uint256_t operator+(const T& lhs, const uint256_t& rhs)
+constexpr uint256_t operator+(const T& lhs, const uint256_t& rhs)
 {
     return rhs + lhs;
 }
@@ -643,7 +1503,7 @@ uint256_t operator+(const T& lhs, const uint256_t& rhs)
 UINT256_T_EXTERN uint128_t& operator+=(uint128_t& lhs, const uint256_t& rhs);
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-T& operator+=(T& lhs, const uint256_t& rhs)
+constexpr T& operator+=(T& lhs, const uint256_t& rhs)
 {
     lhs = static_cast<T>(rhs + lhs);
     return lhs;
@@ -652,7 +1512,7 @@ T& operator+=(T& lhs, const uint256_t& rhs)
 UINT256_T_EXTERN uint256_t operator-(const uint128_t& lhs, const uint256_t& rhs);
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-uint256_t operator-(const T& lhs, const uint256_t& rhs)
+constexpr uint256_t operator-(const T& lhs, const uint256_t& rhs)
 {
     return -(rhs - lhs);
 }
@@ -660,7 +1520,7 @@ uint256_t operator-(const T& lhs, const uint256_t& rhs)
 UINT256_T_EXTERN uint128_t& operator-=(uint128_t& lhs, const uint256_t& rhs);
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-T& operator-=(T& lhs, const uint256_t& rhs)
+constexpr T& operator-=(T& lhs, const uint256_t& rhs)
 {
     return lhs = static_cast<T>(-(rhs - lhs));
 }
@@ -668,7 +1528,7 @@ T& operator-=(T& lhs, const uint256_t& rhs)
 UINT256_T_EXTERN uint256_t operator*(const uint128_t& lhs, const uint256_t& rhs);
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-uint256_t operator*(const T& lhs, const uint256_t& rhs)
+constexpr uint256_t operator*(const T& lhs, const uint256_t& rhs)
 {
     return rhs * lhs;
 }
@@ -676,7 +1536,7 @@ uint256_t operator*(const T& lhs, const uint256_t& rhs)
 UINT256_T_EXTERN uint128_t& operator*=(uint128_t& lhs, const uint256_t& rhs);
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-T& operator*=(T& lhs, const uint256_t& rhs)
+constexpr T& operator*=(T& lhs, const uint256_t& rhs)
 {
     return lhs = static_cast<T>(rhs * lhs);
 }
@@ -684,7 +1544,7 @@ T& operator*=(T& lhs, const uint256_t& rhs)
 UINT256_T_EXTERN uint256_t operator/(const uint128_t& lhs, const uint256_t& rhs);
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-uint256_t operator/(const T& lhs, const uint256_t& rhs)
+constexpr uint256_t operator/(const T& lhs, const uint256_t& rhs)
 {
     return uint256_t(lhs) / rhs;
 }
@@ -692,7 +1552,7 @@ uint256_t operator/(const T& lhs, const uint256_t& rhs)
 UINT256_T_EXTERN uint128_t& operator/=(uint128_t& lhs, const uint256_t& rhs);
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-T& operator/=(T& lhs, const uint256_t& rhs)
+constexpr T& operator/=(T& lhs, const uint256_t& rhs)
 {
     return lhs = static_cast<T>(uint256_t(lhs) / rhs);
 }
@@ -700,7 +1560,7 @@ T& operator/=(T& lhs, const uint256_t& rhs)
 UINT256_T_EXTERN uint256_t operator%(const uint128_t& lhs, const uint256_t& rhs);
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-uint256_t operator%(const T& lhs, const uint256_t& rhs)
+constexpr uint256_t operator%(const T& lhs, const uint256_t& rhs)
 {
     return uint256_t(lhs) % rhs;
 }
@@ -708,11 +1568,31 @@ uint256_t operator%(const T& lhs, const uint256_t& rhs)
 UINT256_T_EXTERN uint128_t& operator%=(uint128_t& lhs, const uint256_t& rhs);
 
 template<typename T, typename = typename std::enable_if<std::is_integral<T>::value, T>::type>
-T& operator%=(T& lhs, const uint256_t& rhs)
+constexpr T& operator%=(T& lhs, const uint256_t& rhs)
 {
     return lhs = static_cast<T>(uint256_t(lhs) % rhs);
 }
 
+// Compile time literals such as 0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f_u256.
+// Hex (0x), binary (0b), octal (leading 0) and decimal are accepted, with ' digit separators.
+// A literal that does not fit in 256 bits is a compile error when used in a constant expression.
+template<char... DIGITS> constexpr uint256_t operator""_u256()
+{
+    constexpr char digits[] = {DIGITS...};
+    return uint256_t::parse_literal(digits, sizeof...(DIGITS));
+}
+
+// Text conversion into and out of caller provided buffers, following std::to_chars / std::from_chars.
+// Digits are lowercase; from_chars accepts either case. Base must be in the range 2-36.
+UINT256_T_EXTERN std::to_chars_result to_chars(char* first, char* last, const uint256_t& value, int base = 10);
+UINT256_T_EXTERN std::from_chars_result from_chars(const char* first, const char* last, uint256_t& value,
+                                                   int base = 10);
+
 // IO Operator
 UINT256_T_EXTERN std::ostream& operator<<(std::ostream& stream, const uint256_t& rhs);
+
+#ifdef UINT256_T_HEADER_ONLY
+#include "../src/uint256_t.cpp"
+#endif
+
 #endif
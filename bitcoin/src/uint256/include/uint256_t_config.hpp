@@ -15,4 +15,13 @@
 #define _UINT256_T_EXPORT __attribute__((visibility("default")))
 #define _UINT256_T_IMPORT __attribute__((visibility("default")))
 #endif
+
+// Defining UINT256_T_HEADER_ONLY before including any of the headers compiles the
+// library sources into the including translation unit instead of linking Uint256Lib,
+// so that every call can be inlined by the compiler
+#ifdef UINT256_T_HEADER_ONLY
+#define UINT256_T_INLINE inline
+#else
+#define UINT256_T_INLINE
+#endif
 #endif
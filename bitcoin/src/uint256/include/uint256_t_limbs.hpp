@@ -0,0 +1,295 @@
+#ifndef _UINT256_T_LIMBS_
+#define _UINT256_T_LIMBS_
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "endianness.h"
+
+// Single-limb primitives shared by the fixed width integer types.
+// Every helper works on 64-bit limbs and maps onto one add-with-carry or
+// subtract-with-borrow instruction where the compiler offers a builtin for it.
+// All of them are constexpr; the builtins and inline assembly are only taken
+// outside of constant evaluation.
+
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_addcll) && __has_builtin(__builtin_subcll)
+#define UINT256_T_HAS_ADDC 1
+#endif
+#endif
+
+namespace uint256_limbs
+{
+
+__extension__ typedef unsigned __int128 dlimb_t;
+
+// Returns a + b + carry_in, storing the carry (0 or 1) in carry_out
+constexpr uint64_t addc(const uint64_t a, const uint64_t b, const uint64_t carry_in, uint64_t& carry_out)
+{
+#ifdef UINT256_T_HAS_ADDC
+    if (!__builtin_is_constant_evaluated())
+    {
+        unsigned long long carry = 0;
+        const uint64_t sum = __builtin_addcll(a, b, carry_in, &carry);
+        carry_out = carry;
+        return sum;
+    }
+#endif
+    uint64_t sum = 0;
+    const bool c1 = __builtin_add_overflow(a, b, &sum);
+    const bool c2 = __builtin_add_overflow(sum, carry_in, &sum);
+    carry_out = c1 | c2;
+    return sum;
+}
+
+// Returns a - b - borrow_in, storing the borrow (0 or 1) in borrow_out
+constexpr uint64_t subb(const uint64_t a, const uint64_t b, const uint64_t borrow_in, uint64_t& borrow_out)
+{
+#ifdef UINT256_T_HAS_ADDC
+    if (!__builtin_is_constant_evaluated())
+    {
+        unsigned long long borrow = 0;
+        const uint64_t diff = __builtin_subcll(a, b, borrow_in, &borrow);
+        borrow_out = borrow;
+        return diff;
+    }
+#endif
+    uint64_t diff = 0;
+    const bool b1 = __builtin_sub_overflow(a, b, &diff);
+    const bool b2 = __builtin_sub_overflow(diff, borrow_in, &diff);
+    borrow_out = b1 | b2;
+    return diff;
+}
+
+// Returns the low half of a * b, storing the high half in high
+constexpr uint64_t mul(const uint64_t a, const uint64_t b, uint64_t& high)
+{
+    const dlimb_t product = (dlimb_t)a * b;
+    high = (uint64_t)(product >> 64);
+    return (uint64_t)product;
+}
+
+#if defined(__x86_64__)
+// Hardware 128/64-bit division. Inline assembly cannot appear in a constexpr function, so it lives here
+inline uint64_t divq(const uint64_t high, const uint64_t low, const uint64_t divisor, uint64_t& remainder)
+{
+    uint64_t quotient = 0;
+    __asm__("divq %4" : "=a"(quotient), "=d"(remainder) : "a"(low), "d"(high), "rm"(divisor));
+    return quotient;
+}
+#endif
+
+// Divides (high:low) by divisor. Requires high < divisor so that the quotient fits in one limb
+constexpr uint64_t div(const uint64_t high, const uint64_t low, const uint64_t divisor, uint64_t& remainder)
+{
+#if defined(__x86_64__)
+    if (!__builtin_is_constant_evaluated())
+    {
+        return divq(high, low, divisor, remainder);
+    }
+#endif
+    const dlimb_t dividend = ((dlimb_t)high << 64) | low;
+    remainder = (uint64_t)(dividend % divisor);
+    return (uint64_t)(dividend / divisor);
+}
+
+// Number of leading zero bits, 64 for zero
+constexpr unsigned int clz(const uint64_t x)
+{
+    return x ? __builtin_clzll(x) : 64;
+}
+
+// Number of trailing zero bits, 64 for zero
+constexpr unsigned int ctz(const uint64_t x)
+{
+    return x ? __builtin_ctzll(x) : 64;
+}
+
+// Number of set bits
+constexpr unsigned int popcount(const uint64_t x)
+{
+    return __builtin_popcountll(x);
+}
+
+// Funnel shifts: the bits shifted out of one limb are shifted into its neighbour. 0 <= shift < 64
+constexpr uint64_t shld(const uint64_t high, const uint64_t low, const unsigned int shift)
+{
+    return shift ? (high << shift) | (low >> (64 - shift)) : high;
+}
+
+constexpr uint64_t shrd(const uint64_t high, const uint64_t low, const unsigned int shift)
+{
+    return shift ? (low >> shift) | (high << (64 - shift)) : low;
+}
+
+// Number of limbs left once the leading zero limbs are dropped
+constexpr int significant(const uint64_t* limbs, int count)
+{
+    while (count > 0 && !limbs[count - 1])
+    {
+        count--;
+    }
+    return count;
+}
+
+// Loads and stores of one limb as 8 bytes in either byte order. Outside of constant evaluation each is a
+// single unaligned memory access plus at most one byte swap
+constexpr uint64_t load_le(const uint8_t* in)
+{
+    if (!__builtin_is_constant_evaluated())
+    {
+        uint64_t x = 0;
+        __builtin_memcpy(&x, in, 8);
+#ifdef __BIG_ENDIAN__
+        x = __builtin_bswap64(x);
+#endif
+        return x;
+    }
+    uint64_t x = 0;
+    for (int i = 7; i >= 0; i--)
+    {
+        x = (x << 8) | in[i];
+    }
+    return x;
+}
+
+constexpr uint64_t load_be(const uint8_t* in)
+{
+    return __builtin_bswap64(load_le(in));
+}
+
+constexpr void store_le(uint8_t* out, const uint64_t x)
+{
+    if (!__builtin_is_constant_evaluated())
+    {
+#ifdef __BIG_ENDIAN__
+        const uint64_t y = __builtin_bswap64(x);
+#else
+        const uint64_t y = x;
+#endif
+        __builtin_memcpy(out, &y, 8);
+        return;
+    }
+    for (int i = 0; i < 8; i++)
+    {
+        out[i] = (uint8_t)(x >> (8 * i));
+    }
+}
+
+constexpr void store_be(uint8_t* out, const uint64_t x)
+{
+    store_le(out, __builtin_bswap64(x));
+}
+
+// Calls f(0), f(1), ..., f(N - 1) in order, each index passed as a std::integral_constant, so
+// that a limb loop over a fixed count is expanded in place rather than left to the optimizer
+template<class F, std::size_t... I>
+constexpr void unroll(F&& f, std::index_sequence<I...>)
+{
+    (f(std::integral_constant<std::size_t, I>()), ...);
+}
+
+template<std::size_t N, class F>
+constexpr void unroll(F&& f)
+{
+    unroll(f, std::make_index_sequence<N>());
+}
+
+// Long division of u (m limbs) by v (n limbs, top limb non-zero) following
+// Knuth, TAOCP vol. 2, 4.3.1, Algorithm D. Each quotient limb is estimated from
+// a 128/64-bit division and corrected at most twice. Requires CAPACITY >= m >= n >= 1;
+// q receives m - n + 1 limbs and r receives n limbs.
+template<int CAPACITY>
+constexpr void divmod(const uint64_t* u, const int m, const uint64_t* v, const int n, uint64_t* q, uint64_t* r)
+{
+    // Single limb divisor: one hardware division per limb
+    if (n == 1)
+    {
+        uint64_t remainder = 0;
+        for (int j = m - 1; j >= 0; j--)
+        {
+            q[j] = div(remainder, u[j], v[0], remainder);
+        }
+        r[0] = remainder;
+        return;
+    }
+
+    // D1: normalize so that the top bit of the divisor is set
+    const unsigned int shift = clz(v[n - 1]);
+    uint64_t vn[CAPACITY] = {};
+    uint64_t un[CAPACITY + 1] = {};
+    for (int i = n - 1; i > 0; i--)
+    {
+        vn[i] = shld(v[i], v[i - 1], shift);
+    }
+    vn[0] = v[0] << shift;
+    un[m] = shld(0, u[m - 1], shift);
+    for (int i = m - 1; i > 0; i--)
+    {
+        un[i] = shld(u[i], u[i - 1], shift);
+    }
+    un[0] = u[0] << shift;
+
+    for (int j = m - n; j >= 0; j--)
+    {
+        // D3: estimate the quotient limb from the top two limbs of the running remainder
+        uint64_t qhat = 0, rhat = 0;
+        bool rhat_overflow = false;
+        if (un[j + n] >= vn[n - 1])
+        {
+            qhat = ~(uint64_t)0;
+            uint64_t carry = 0;
+            rhat = addc(un[j + n - 1], vn[n - 1], 0, carry);
+            rhat_overflow = carry;
+        }
+        else
+        {
+            qhat = div(un[j + n], un[j + n - 1], vn[n - 1], rhat);
+        }
+        while (!rhat_overflow && ((dlimb_t)qhat * vn[n - 2] > (((dlimb_t)rhat << 64) | un[j + n - 2])))
+        {
+            qhat--;
+            uint64_t carry = 0;
+            rhat = addc(rhat, vn[n - 1], 0, carry);
+            rhat_overflow = carry;
+        }
+
+        // D4: multiply and subtract
+        uint64_t borrow = 0, carry = 0;
+        for (int i = 0; i < n; i++)
+        {
+            uint64_t high = 0;
+            const uint64_t low = mul(qhat, vn[i], high);
+            uint64_t c = 0;
+            const uint64_t product = addc(low, carry, 0, c);
+            carry = high + c;
+            un[i + j] = subb(un[i + j], product, borrow, borrow);
+        }
+        un[j + n] = subb(un[j + n], carry, borrow, borrow);
+
+        // D6: the estimate was one too large, add the divisor back
+        if (borrow)
+        {
+            qhat--;
+            carry = 0;
+            for (int i = 0; i < n; i++)
+            {
+                un[i + j] = addc(un[i + j], vn[i], carry, carry);
+            }
+            un[j + n] += carry;
+        }
+        q[j] = qhat;
+    }
+
+    // D8: unnormalize the remainder
+    for (int i = 0; i < n; i++)
+    {
+        r[i] = shrd(un[i + 1], un[i], shift);
+    }
+}
+
+} // namespace uint256_limbs
+
+#endif
@@ -0,0 +1,139 @@
+/*
+uint512_t.hpp
+Double width companion of uint256_t
+
+Holds full 256x256-bit products so that modular multiplication with
+256-bit moduli never loses the upper half of the product. The storage and
+the limb loops are those of wide_uint<512>; this class only adds the
+uint256_t halves and the division by a 256-bit divisor.
+*/
+
+#ifndef __UINT512_T__
+#define __UINT512_T__
+
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+#include "uint256_t.hpp"
+#include "uint256_t_config.hpp"
+#include "wide_uint.hpp"
+
+class UINT256_T_EXTERN uint512_t;
+
+class uint512_t : public wide_uint<512>
+{
+  public:
+    // Constructors
+    constexpr uint512_t() = default;
+    constexpr uint512_t(const uint512_t& rhs) = default;
+    constexpr uint512_t(uint512_t&& rhs) = default;
+    constexpr uint512_t(const uint256_t& lower_rhs)
+      : wide_uint<512>(lower_rhs)
+    {
+    }
+
+    constexpr uint512_t(const uint256_t& upper_rhs, const uint256_t& lower_rhs)
+      : wide_uint<512>((wide_uint<512>(upper_rhs) << 256) | wide_uint<512>(lower_rhs))
+    {
+    }
+
+    // Widening product of two 256-bit values
+    constexpr uint512_t(const std::pair<uint256_t, uint256_t>& upper_lower)
+      : uint512_t(upper_lower.first, upper_lower.second)
+    {
+    }
+
+    // Assignment Operator
+    constexpr uint512_t& operator=(const uint512_t& rhs) = default;
+    constexpr uint512_t& operator=(uint512_t&& rhs) = default;
+
+    // Arithmetic Operators
+    constexpr uint512_t operator+(const uint512_t& rhs) const
+    {
+        return uint512_t(*this) += rhs;
+    }
+
+    constexpr uint512_t& operator+=(const uint512_t& rhs)
+    {
+        wide_uint<512>::operator+=(rhs);
+        return *this;
+    }
+
+    constexpr uint512_t operator-(const uint512_t& rhs) const
+    {
+        return uint512_t(*this) -= rhs;
+    }
+
+    constexpr uint512_t& operator-=(const uint512_t& rhs)
+    {
+        wide_uint<512>::operator-=(rhs);
+        return *this;
+    }
+
+    constexpr uint512_t operator/(const uint256_t& rhs) const
+    {
+        uint64_t q[8] = {};
+        uint64_t r[4] = {};
+        divmod(rhs, q, r);
+        return uint512_t(uint256_t(q[7], q[6], q[5], q[4]), uint256_t(q[3], q[2], q[1], q[0]));
+    }
+
+    constexpr uint256_t operator%(const uint256_t& rhs) const
+    {
+        uint64_t q[8] = {};
+        uint64_t r[4] = {};
+        divmod(rhs, q, r);
+        return uint256_t(r[3], r[2], r[1], r[0]);
+    }
+
+    // Get private values
+    constexpr uint256_t upper() const
+    {
+        return uint256_t(limb(7), limb(6), limb(5), limb(4));
+    }
+
+    constexpr uint256_t lower() const
+    {
+        return uint256_t(limb(3), limb(2), limb(1), limb(0));
+    }
+
+    // Get bitsize of value
+    constexpr uint16_t bits() const
+    {
+        return static_cast<uint16_t>(wide_uint<512>::bits());
+    }
+
+  private:
+    // wide_uint<512>::divmod would widen the divisor and the remainder to 512 bits
+    constexpr void divmod(const uint256_t& rhs, uint64_t (&q)[8], uint64_t (&r)[4]) const
+    {
+        if (rhs == uint256_0)
+        {
+            throw std::domain_error("Error: division or modulus by 0");
+        }
+
+        const uint64_t u[8] = {limb(0), limb(1), limb(2), limb(3), limb(4), limb(5), limb(6), limb(7)};
+        const uint64_t v[4] = {rhs.limb(0), rhs.limb(1), rhs.limb(2), rhs.limb(3)};
+        const int m = uint256_limbs::significant(u, 8);
+        const int n = uint256_limbs::significant(v, 4);
+        if (m < n)
+        {
+            for (int i = 0; i < 4; i++)
+            {
+                r[i] = u[i];
+            }
+            return;
+        }
+        uint256_limbs::divmod<8>(u, m, v, n, q, r);
+    }
+};
+
+// (lhs * rhs) % mod without truncating the intermediate product
+UINT256_T_EXTERN uint256_t mulmod(const uint256_t& lhs, const uint256_t& rhs, const uint256_t& mod);
+
+#ifdef UINT256_T_HEADER_ONLY
+#include "../src/uint512_t.cpp"
+#endif
+
+#endif
@@ -0,0 +1,373 @@
+/*
+wide_uint.hpp
+Unsigned integers of any whole number of 64-bit limbs
+
+wide_uint<BITS> is built entirely from the limb primitives in
+uint256_t_limbs.hpp. The loops over the limbs are expanded at compile time,
+so every width gets the same straight-line carry chains without any of them
+being written out by hand. uint384_t, uint1024_t and uint3072_t name the
+widths used for wide products, hash accumulators and Barrett constants.
+*/
+
+#ifndef __WIDE_UINT__
+#define __WIDE_UINT__
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "uint256_t.hpp"
+#include "uint256_t_limbs.hpp"
+
+template<std::size_t BITS>
+class wide_uint
+{
+    static_assert(BITS >= 128 && BITS % 64 == 0, "wide_uint needs a whole number of at least two limbs");
+
+  public:
+    static constexpr std::size_t LIMB_COUNT = BITS / 64;
+
+  private:
+    // Least significant limb first
+    uint64_t LIMBS[LIMB_COUNT] = {};
+
+    template<std::size_t OTHER>
+    friend class wide_uint;
+
+  public:
+    // Constructors
+    constexpr wide_uint() = default;
+    constexpr wide_uint(const uint64_t rhs)
+      : LIMBS{rhs}
+    {
+    }
+
+    // Values wider than BITS are truncated
+    constexpr wide_uint(const uint256_t& rhs)
+    {
+        uint256_limbs::unroll<std::min<std::size_t>(LIMB_COUNT, 4)>([&](auto i) { LIMBS[i] = rhs.limb(i); });
+    }
+
+    // Zero extends or truncates another width
+    template<std::size_t OTHER>
+    constexpr explicit wide_uint(const wide_uint<OTHER>& rhs)
+    {
+        uint256_limbs::unroll<std::min(LIMB_COUNT, wide_uint<OTHER>::LIMB_COUNT)>([&](auto i) {
+            LIMBS[i] = rhs.LIMBS[i];
+        });
+    }
+
+    // The lowest 256 bits
+    constexpr explicit operator uint256_t() const
+    {
+        return uint256_t(limb(3), limb(2), limb(1), limb(0));
+    }
+
+    constexpr explicit operator bool() const
+    {
+        uint64_t any = 0;
+        uint256_limbs::unroll<LIMB_COUNT>([&](auto i) { any |= LIMBS[i]; });
+        return any;
+    }
+
+    // Get private values
+    constexpr uint64_t limb(const unsigned int index) const
+    {
+        return index < LIMB_COUNT ? LIMBS[index] : 0;
+    }
+
+    // Number of bits needed to hold the value, 0 for zero
+    constexpr unsigned int bits() const
+    {
+        const int count = uint256_limbs::significant(LIMBS, LIMB_COUNT);
+        return count ? count * 64 - uint256_limbs::clz(LIMBS[count - 1]) : 0;
+    }
+
+    constexpr bool test_bit(const unsigned int bit) const
+    {
+        return bit < BITS && ((LIMBS[bit / 64] >> (bit % 64)) & 1);
+    }
+
+    // Comparison Operators
+    constexpr bool operator==(const wide_uint& rhs) const
+    {
+        uint64_t diff = 0;
+        uint256_limbs::unroll<LIMB_COUNT>([&](auto i) { diff |= LIMBS[i] ^ rhs.LIMBS[i]; });
+        return !diff;
+    }
+
+    constexpr bool operator!=(const wide_uint& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
+    // lhs < rhs exactly when lhs - rhs borrows out of the top limb
+    constexpr bool operator<(const wide_uint& rhs) const
+    {
+        uint64_t borrow = 0;
+        uint256_limbs::unroll<LIMB_COUNT>([&](auto i) {
+            uint256_limbs::subb(LIMBS[i], rhs.LIMBS[i], borrow, borrow);
+        });
+        return borrow;
+    }
+
+    constexpr bool operator>(const wide_uint& rhs) const
+    {
+        return rhs < *this;
+    }
+
+    constexpr bool operator<=(const wide_uint& rhs) const
+    {
+        return !(rhs < *this);
+    }
+
+    constexpr bool operator>=(const wide_uint& rhs) const
+    {
+        return !(*this < rhs);
+    }
+
+    // Bitwise Operators
+    constexpr wide_uint& operator&=(const wide_uint& rhs)
+    {
+        uint256_limbs::unroll<LIMB_COUNT>([&](auto i) { LIMBS[i] &= rhs.LIMBS[i]; });
+        return *this;
+    }
+
+    constexpr wide_uint& operator|=(const wide_uint& rhs)
+    {
+        uint256_limbs::unroll<LIMB_COUNT>([&](auto i) { LIMBS[i] |= rhs.LIMBS[i]; });
+        return *this;
+    }
+
+    constexpr wide_uint& operator^=(const wide_uint& rhs)
+    {
+        uint256_limbs::unroll<LIMB_COUNT>([&](auto i) { LIMBS[i] ^= rhs.LIMBS[i]; });
+        return *this;
+    }
+
+    constexpr wide_uint operator&(const wide_uint& rhs) const
+    {
+        return wide_uint(*this) &= rhs;
+    }
+
+    constexpr wide_uint operator|(const wide_uint& rhs) const
+    {
+        return wide_uint(*this) |= rhs;
+    }
+
+    constexpr wide_uint operator^(const wide_uint& rhs) const
+    {
+        return wide_uint(*this) ^= rhs;
+    }
+
+    constexpr wide_uint operator~() const
+    {
+        wide_uint out;
+        uint256_limbs::unroll<LIMB_COUNT>([&](auto i) { out.LIMBS[i] = ~LIMBS[i]; });
+        return out;
+    }
+
+    // Bit Shift Operators
+    constexpr wide_uint operator<<(const unsigned int shift) const
+    {
+        wide_uint out;
+        if (shift >= BITS)
+        {
+            return out;
+        }
+
+        const std::size_t limbs = shift / 64;
+        const unsigned int bits = shift % 64;
+        uint256_limbs::unroll<LIMB_COUNT>([&](auto i) {
+            if (i >= limbs)
+            {
+                out.LIMBS[i] = uint256_limbs::shld(LIMBS[i - limbs], i > limbs ? LIMBS[i - limbs - 1] : 0, bits);
+            }
+        });
+        return out;
+    }
+
+    constexpr wide_uint operator>>(const unsigned int shift) const
+    {
+        wide_uint out;
+        if (shift >= BITS)
+        {
+            return out;
+        }
+
+        const std::size_t limbs = shift / 64;
+        const unsigned int bits = shift % 64;
+        uint256_limbs::unroll<LIMB_COUNT>([&](auto i) {
+            if (i + limbs < LIMB_COUNT)
+            {
+                const uint64_t high = i + limbs + 1 < LIMB_COUNT ? LIMBS[i + limbs + 1] : 0;
+                out.LIMBS[i] = uint256_limbs::shrd(high, LIMBS[i + limbs], bits);
+            }
+        });
+        return out;
+    }
+
+    constexpr wide_uint& operator<<=(const unsigned int shift)
+    {
+        return *this = *this << shift;
+    }
+
+    constexpr wide_uint& operator>>=(const unsigned int shift)
+    {
+        return *this = *this >> shift;
+    }
+
+    // Arithmetic Operators, all modulo 2^BITS
+    constexpr wide_uint& operator+=(const wide_uint& rhs)
+    {
+        uint64_t carry = 0;
+        uint256_limbs::unroll<LIMB_COUNT>([&](auto i) {
+            LIMBS[i] = uint256_limbs::addc(LIMBS[i], rhs.LIMBS[i], carry, carry);
+        });
+        return *this;
+    }
+
+    constexpr wide_uint& operator-=(const wide_uint& rhs)
+    {
+        uint64_t borrow = 0;
+        uint256_limbs::unroll<LIMB_COUNT>([&](auto i) {
+            LIMBS[i] = uint256_limbs::subb(LIMBS[i], rhs.LIMBS[i], borrow, borrow);
+        });
+        return *this;
+    }
+
+    constexpr wide_uint operator+(const wide_uint& rhs) const
+    {
+        return wide_uint(*this) += rhs;
+    }
+
+    constexpr wide_uint operator-(const wide_uint& rhs) const
+    {
+        return wide_uint(*this) -= rhs;
+    }
+
+    constexpr wide_uint operator-() const
+    {
+        return wide_uint() - *this;
+    }
+
+    // Schoolbook product, skipping the columns at or above 2^BITS
+    constexpr wide_uint operator*(const wide_uint& rhs) const
+    {
+        using uint256_limbs::dlimb_t;
+
+        wide_uint out;
+        for (std::size_t i = 0; i < LIMB_COUNT; i++)
+        {
+            uint64_t carry = 0;
+            uint256_limbs::unroll<LIMB_COUNT>([&](auto j) {
+                if (i + j < LIMB_COUNT)
+                {
+                    const dlimb_t t = (dlimb_t)LIMBS[i] * rhs.LIMBS[j] + out.LIMBS[i + j] + carry;
+                    out.LIMBS[i + j] = (uint64_t)t;
+                    carry = (uint64_t)(t >> 64);
+                }
+            });
+        }
+        return out;
+    }
+
+    constexpr wide_uint& operator*=(const wide_uint& rhs)
+    {
+        return *this = *this * rhs;
+    }
+
+    // Full double width product
+    constexpr wide_uint<2 * BITS> mul_wide(const wide_uint& rhs) const
+    {
+        using uint256_limbs::dlimb_t;
+
+        wide_uint<2 * BITS> out;
+        for (std::size_t i = 0; i < LIMB_COUNT; i++)
+        {
+            uint64_t carry = 0;
+            uint256_limbs::unroll<LIMB_COUNT>([&](auto j) {
+                const dlimb_t t = (dlimb_t)LIMBS[i] * rhs.LIMBS[j] + out.LIMBS[i + j] + carry;
+                out.LIMBS[i + j] = (uint64_t)t;
+                carry = (uint64_t)(t >> 64);
+            });
+            out.LIMBS[i + LIMB_COUNT] = carry;
+        }
+        return out;
+    }
+
+    // Quotient and remainder
+    static constexpr std::pair<wide_uint, wide_uint> divmod(const wide_uint& lhs, const wide_uint& rhs)
+    {
+        const int n = uint256_limbs::significant(rhs.LIMBS, LIMB_COUNT);
+        if (!n)
+        {
+            throw std::domain_error("Error: division or modulus by 0");
+        }
+        const int m = uint256_limbs::significant(lhs.LIMBS, LIMB_COUNT);
+        if (m < n)
+        {
+            return std::pair<wide_uint, wide_uint>(wide_uint(), lhs);
+        }
+
+        std::pair<wide_uint, wide_uint> qr;
+        uint256_limbs::divmod<LIMB_COUNT>(lhs.LIMBS, m, rhs.LIMBS, n, qr.first.LIMBS, qr.second.LIMBS);
+        return qr;
+    }
+
+    constexpr wide_uint operator/(const wide_uint& rhs) const
+    {
+        return divmod(*this, rhs).first;
+    }
+
+    constexpr wide_uint operator%(const wide_uint& rhs) const
+    {
+        return divmod(*this, rhs).second;
+    }
+
+    constexpr wide_uint& operator/=(const wide_uint& rhs)
+    {
+        return *this = *this / rhs;
+    }
+
+    constexpr wide_uint& operator%=(const wide_uint& rhs)
+    {
+        return *this = *this % rhs;
+    }
+
+    // Digits in base 2-36, lower case
+    std::string str(const unsigned int base = 10) const
+    {
+        if ((base < 2) || (base > 36))
+        {
+            throw std::invalid_argument("Base must be in the range 2-36");
+        }
+
+        std::string out;
+        wide_uint value(*this);
+        do
+        {
+            const std::pair<wide_uint, wide_uint> qr = divmod(value, base);
+            out.push_back("0123456789abcdefghijklmnopqrstuvwxyz"[qr.second.LIMBS[0]]);
+            value = qr.first;
+        } while (value);
+        std::reverse(out.begin(), out.end());
+        return out;
+    }
+};
+
+// (a * b) % m over the full double width product
+template<std::size_t BITS>
+constexpr wide_uint<BITS> mulmod(const wide_uint<BITS>& a, const wide_uint<BITS>& b, const wide_uint<BITS>& m)
+{
+    return wide_uint<BITS>(a.mul_wide(b) % wide_uint<2 * BITS>(m));
+}
+
+typedef wide_uint<384> uint384_t;
+typedef wide_uint<1024> uint1024_t;
+typedef wide_uint<3072> uint3072_t;
+
+#endif
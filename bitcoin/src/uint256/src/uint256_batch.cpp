@@ -0,0 +1,411 @@
+#include "uint256_batch.hpp"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#define UINT256_BATCH_HAS_AVX2 1
+#endif
+
+namespace uint256_detail
+{
+
+inline void check_sizes(uint256_batch_t& out, const uint256_batch_t& lhs, const uint256_batch_t& rhs)
+{
+    if (lhs.size() != rhs.size())
+    {
+        throw std::invalid_argument("Error: batches differ in size");
+    }
+    out.resize(lhs.size());
+}
+
+inline bool cpu_has_avx2()
+{
+#ifdef UINT256_BATCH_HAS_AVX2
+    return __builtin_cpu_supports("avx2");
+#else
+    return false;
+#endif
+}
+
+#ifdef UINT256_BATCH_HAS_AVX2
+// Four lanes of 64 bits. Carries and borrows are kept as masks: all ones for 1, zero for 0
+
+#define UINT256_BATCH_AVX2 __attribute__((target("avx2")))
+
+UINT256_BATCH_AVX2 inline __m256i load(const uint64_t* column, const std::size_t index)
+{
+    return _mm256_loadu_si256((const __m256i*)(column + index));
+}
+
+UINT256_BATCH_AVX2 inline void store(uint64_t* column, const std::size_t index, const __m256i value)
+{
+    _mm256_storeu_si256((__m256i*)(column + index), value);
+}
+
+// AVX2 only compares signed lanes; flipping the sign bits turns that into an unsigned compare
+UINT256_BATCH_AVX2 inline __m256i less_than(const __m256i a, const __m256i b)
+{
+    const __m256i sign = _mm256_set1_epi64x((long long)0x8000000000000000ULL);
+    return _mm256_cmpgt_epi64(_mm256_xor_si256(b, sign), _mm256_xor_si256(a, sign));
+}
+
+UINT256_BATCH_AVX2 inline __m256i addc(const __m256i a, const __m256i b, __m256i& carry)
+{
+    const __m256i sum = _mm256_add_epi64(a, b);
+    const __m256i out = _mm256_sub_epi64(sum, carry);
+    carry = _mm256_or_si256(less_than(sum, a), less_than(out, sum));
+    return out;
+}
+
+UINT256_BATCH_AVX2 inline __m256i subb(const __m256i a, const __m256i b, __m256i& borrow)
+{
+    const __m256i diff = _mm256_sub_epi64(a, b);
+    const __m256i out = _mm256_add_epi64(diff, borrow);
+    borrow = _mm256_or_si256(less_than(a, b), less_than(diff, out));
+    return out;
+}
+
+// Each kernel handles whole groups of four from index 0 and returns where it stopped,
+// leaving the remainder to the scalar loop
+UINT256_BATCH_AVX2 inline std::size_t add_avx2(const uint64_t* const (&lhs)[4], const uint64_t* const (&rhs)[4],
+                                               uint64_t* const (&dst)[4], const std::size_t size)
+{
+    std::size_t i = 0;
+    for (; i + 4 <= size; i += 4)
+    {
+        __m256i carry = _mm256_setzero_si256();
+        for (int limb = 0; limb < 4; limb++)
+        {
+            store(dst[limb], i, addc(load(lhs[limb], i), load(rhs[limb], i), carry));
+        }
+    }
+    return i;
+}
+
+UINT256_BATCH_AVX2 inline std::size_t sub_avx2(const uint64_t* const (&lhs)[4], const uint64_t* const (&rhs)[4],
+                                               uint64_t* const (&dst)[4], const std::size_t size)
+{
+    std::size_t i = 0;
+    for (; i + 4 <= size; i += 4)
+    {
+        __m256i borrow = _mm256_setzero_si256();
+        for (int limb = 0; limb < 4; limb++)
+        {
+            store(dst[limb], i, subb(load(lhs[limb], i), load(rhs[limb], i), borrow));
+        }
+    }
+    return i;
+}
+
+UINT256_BATCH_AVX2 inline std::size_t less_avx2(const uint64_t* const (&lhs)[4], const uint64_t* const (&rhs)[4],
+                                                uint64_t* mask, const std::size_t size)
+{
+    // lhs < rhs exactly when lhs - rhs borrows out of the top limb
+    std::size_t i = 0;
+    for (; i + 4 <= size; i += 4)
+    {
+        __m256i borrow = _mm256_setzero_si256();
+        for (int limb = 0; limb < 4; limb++)
+        {
+            subb(load(lhs[limb], i), load(rhs[limb], i), borrow);
+        }
+        store(mask, i, borrow);
+    }
+    return i;
+}
+
+UINT256_BATCH_AVX2 inline std::size_t select_avx2(const uint64_t* mask, const uint64_t* const (&lhs)[4],
+                                                  const uint64_t* const (&rhs)[4], uint64_t* const (&dst)[4],
+                                                  const std::size_t size)
+{
+    std::size_t i = 0;
+    for (; i + 4 <= size; i += 4)
+    {
+        const __m256i m = load(mask, i);
+        for (int limb = 0; limb < 4; limb++)
+        {
+            store(dst[limb], i, _mm256_blendv_epi8(load(rhs[limb], i), load(lhs[limb], i), m));
+        }
+    }
+    return i;
+}
+
+UINT256_BATCH_AVX2 inline std::size_t add_mod_avx2(const uint64_t* const (&lhs)[4], const uint64_t* const (&rhs)[4],
+                                                   const uint256_t& modulus, uint64_t* const (&dst)[4],
+                                                   const std::size_t size)
+{
+    __m256i m[4];
+    for (int limb = 0; limb < 4; limb++)
+    {
+        m[limb] = _mm256_set1_epi64x((long long)modulus.limb(limb));
+    }
+
+    std::size_t i = 0;
+    for (; i + 4 <= size; i += 4)
+    {
+        // Subtract the modulus from the sum unless that borrows without the sum having carried
+        __m256i sum[4], reduced[4];
+        __m256i carry = _mm256_setzero_si256(), borrow = _mm256_setzero_si256();
+        for (int limb = 0; limb < 4; limb++)
+        {
+            sum[limb] = addc(load(lhs[limb], i), load(rhs[limb], i), carry);
+            reduced[limb] = subb(sum[limb], m[limb], borrow);
+        }
+        const __m256i keep = _mm256_andnot_si256(carry, borrow);
+        for (int limb = 0; limb < 4; limb++)
+        {
+            store(dst[limb], i, _mm256_blendv_epi8(reduced[limb], sum[limb], keep));
+        }
+    }
+    return i;
+}
+
+UINT256_BATCH_AVX2 inline std::size_t sub_mod_avx2(const uint64_t* const (&lhs)[4], const uint64_t* const (&rhs)[4],
+                                                   const uint256_t& modulus, uint64_t* const (&dst)[4],
+                                                   const std::size_t size)
+{
+    __m256i m[4];
+    for (int limb = 0; limb < 4; limb++)
+    {
+        m[limb] = _mm256_set1_epi64x((long long)modulus.limb(limb));
+    }
+
+    std::size_t i = 0;
+    for (; i + 4 <= size; i += 4)
+    {
+        // Add the modulus back wherever the difference borrowed
+        __m256i diff[4];
+        __m256i borrow = _mm256_setzero_si256(), carry = _mm256_setzero_si256();
+        for (int limb = 0; limb < 4; limb++)
+        {
+            diff[limb] = subb(load(lhs[limb], i), load(rhs[limb], i), borrow);
+        }
+        for (int limb = 0; limb < 4; limb++)
+        {
+            const __m256i corrected = addc(diff[limb], m[limb], carry);
+            store(dst[limb], i, _mm256_blendv_epi8(diff[limb], corrected, borrow));
+        }
+    }
+    return i;
+}
+
+#undef UINT256_BATCH_AVX2
+#endif
+
+} // namespace uint256_detail
+
+UINT256_T_INLINE uint256_batch_t::uint256_batch_t(const std::size_t size)
+  : SIZE(size)
+  , LIMBS{std::vector<uint64_t>(size), std::vector<uint64_t>(size), std::vector<uint64_t>(size),
+          std::vector<uint64_t>(size)}
+{
+}
+
+UINT256_T_INLINE uint256_batch_t::uint256_batch_t(const std::vector<uint256_t>& values)
+  : uint256_batch_t(values.size())
+{
+    for (std::size_t i = 0; i < values.size(); i++)
+    {
+        set(i, values[i]);
+    }
+}
+
+UINT256_T_INLINE std::atomic<bool>& uint256_batch_t::avx2()
+{
+    static std::atomic<bool> enabled(uint256_detail::cpu_has_avx2());
+    return enabled;
+}
+
+UINT256_T_INLINE std::size_t uint256_batch_t::size() const
+{
+    return SIZE;
+}
+
+UINT256_T_INLINE void uint256_batch_t::resize(const std::size_t size)
+{
+    SIZE = size;
+    for (int limb = 0; limb < 4; limb++)
+    {
+        LIMBS[limb].resize(size);
+    }
+}
+
+UINT256_T_INLINE uint256_t uint256_batch_t::get(const std::size_t index) const
+{
+    return uint256_t(LIMBS[3][index], LIMBS[2][index], LIMBS[1][index], LIMBS[0][index]);
+}
+
+UINT256_T_INLINE void uint256_batch_t::set(const std::size_t index, const uint256_t& value)
+{
+    for (int limb = 0; limb < 4; limb++)
+    {
+        LIMBS[limb][index] = value.limb(limb);
+    }
+}
+
+UINT256_T_INLINE void uint256_batch_t::columns(const uint64_t* (&out)[4]) const
+{
+    for (int limb = 0; limb < 4; limb++)
+    {
+        out[limb] = LIMBS[limb].data();
+    }
+}
+
+UINT256_T_INLINE void uint256_batch_t::columns(uint64_t* (&out)[4])
+{
+    for (int limb = 0; limb < 4; limb++)
+    {
+        out[limb] = LIMBS[limb].data();
+    }
+}
+
+UINT256_T_INLINE void uint256_batch_t::add(uint256_batch_t& out, const uint256_batch_t& lhs, const uint256_batch_t& rhs)
+{
+    uint256_detail::check_sizes(out, lhs, rhs);
+    std::size_t i = 0;
+#ifdef UINT256_BATCH_HAS_AVX2
+    if (avx2().load(std::memory_order_relaxed))
+    {
+        const uint64_t *l[4], *r[4];
+        uint64_t* d[4];
+        lhs.columns(l);
+        rhs.columns(r);
+        out.columns(d);
+        i = uint256_detail::add_avx2(l, r, d, out.SIZE);
+    }
+#endif
+    for (; i < out.SIZE; i++)
+    {
+        out.set(i, lhs.get(i) + rhs.get(i));
+    }
+}
+
+UINT256_T_INLINE void uint256_batch_t::sub(uint256_batch_t& out, const uint256_batch_t& lhs, const uint256_batch_t& rhs)
+{
+    uint256_detail::check_sizes(out, lhs, rhs);
+    std::size_t i = 0;
+#ifdef UINT256_BATCH_HAS_AVX2
+    if (avx2().load(std::memory_order_relaxed))
+    {
+        const uint64_t *l[4], *r[4];
+        uint64_t* d[4];
+        lhs.columns(l);
+        rhs.columns(r);
+        out.columns(d);
+        i = uint256_detail::sub_avx2(l, r, d, out.SIZE);
+    }
+#endif
+    for (; i < out.SIZE; i++)
+    {
+        out.set(i, lhs.get(i) - rhs.get(i));
+    }
+}
+
+UINT256_T_INLINE void uint256_batch_t::less(std::vector<uint64_t>& mask, const uint256_batch_t& lhs,
+                                            const uint256_batch_t& rhs)
+{
+    if (lhs.size() != rhs.size())
+    {
+        throw std::invalid_argument("Error: batches differ in size");
+    }
+    mask.resize(lhs.SIZE);
+    std::size_t i = 0;
+#ifdef UINT256_BATCH_HAS_AVX2
+    if (avx2().load(std::memory_order_relaxed))
+    {
+        const uint64_t *l[4], *r[4];
+        lhs.columns(l);
+        rhs.columns(r);
+        i = uint256_detail::less_avx2(l, r, mask.data(), lhs.SIZE);
+    }
+#endif
+    for (; i < lhs.SIZE; i++)
+    {
+        mask[i] = lhs.get(i) < rhs.get(i) ? ~(uint64_t)0 : 0;
+    }
+}
+
+UINT256_T_INLINE void uint256_batch_t::select(uint256_batch_t& out, const std::vector<uint64_t>& mask,
+                                              const uint256_batch_t& lhs, const uint256_batch_t& rhs)
+{
+    uint256_detail::check_sizes(out, lhs, rhs);
+    if (mask.size() != lhs.SIZE)
+    {
+        throw std::invalid_argument("Error: batches differ in size");
+    }
+    std::size_t i = 0;
+#ifdef UINT256_BATCH_HAS_AVX2
+    if (avx2().load(std::memory_order_relaxed))
+    {
+        const uint64_t *l[4], *r[4];
+        uint64_t* d[4];
+        lhs.columns(l);
+        rhs.columns(r);
+        out.columns(d);
+        i = uint256_detail::select_avx2(mask.data(), l, r, d, out.SIZE);
+    }
+#endif
+    for (; i < out.SIZE; i++)
+    {
+        out.set(i, mask[i] ? lhs.get(i) : rhs.get(i));
+    }
+}
+
+UINT256_T_INLINE void uint256_batch_t::add_mod(uint256_batch_t& out, const uint256_batch_t& lhs,
+                                               const uint256_batch_t& rhs, const uint256_t& modulus)
+{
+    uint256_detail::check_sizes(out, lhs, rhs);
+    std::size_t i = 0;
+#ifdef UINT256_BATCH_HAS_AVX2
+    if (avx2().load(std::memory_order_relaxed))
+    {
+        const uint64_t *l[4], *r[4];
+        uint64_t* d[4];
+        lhs.columns(l);
+        rhs.columns(r);
+        out.columns(d);
+        i = uint256_detail::add_mod_avx2(l, r, modulus, d, out.SIZE);
+    }
+#endif
+    for (; i < out.SIZE; i++)
+    {
+        const uint256_t a = lhs.get(i);
+        const uint256_t sum = a + rhs.get(i);
+        out.set(i, (sum < a || sum >= modulus) ? sum - modulus : sum);
+    }
+}
+
+UINT256_T_INLINE void uint256_batch_t::sub_mod(uint256_batch_t& out, const uint256_batch_t& lhs,
+                                               const uint256_batch_t& rhs, const uint256_t& modulus)
+{
+    uint256_detail::check_sizes(out, lhs, rhs);
+    std::size_t i = 0;
+#ifdef UINT256_BATCH_HAS_AVX2
+    if (avx2().load(std::memory_order_relaxed))
+    {
+        const uint64_t *l[4], *r[4];
+        uint64_t* d[4];
+        lhs.columns(l);
+        rhs.columns(r);
+        out.columns(d);
+        i = uint256_detail::sub_mod_avx2(l, r, modulus, d, out.SIZE);
+    }
+#endif
+    for (; i < out.SIZE; i++)
+    {
+        const uint256_t a = lhs.get(i);
+        const uint256_t b = rhs.get(i);
+        out.set(i, a < b ? a - b + modulus : a - b);
+    }
+}
+
+UINT256_T_INLINE bool uint256_batch_t::use_avx2(const bool enable)
+{
+    const bool enabled = enable && uint256_detail::cpu_has_avx2();
+    avx2().store(enabled, std::memory_order_relaxed);
+    return enabled;
+}
+
+UINT256_T_INLINE bool uint256_batch_t::uses_avx2()
+{
+    return avx2().load(std::memory_order_relaxed);
+}
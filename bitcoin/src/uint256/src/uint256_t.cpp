@@ -1,940 +1,569 @@
 #include "uint256_t.hpp"
+#include "uint256_t_limbs.hpp"
 #include <cstring>
 #include <vector>
 
-const uint128_t uint128_64(64);
-const uint128_t uint128_128(128);
-const uint128_t uint128_256(256);
-const uint256_t uint256_0(0);
-const uint256_t uint256_1(1);
-const uint256_t uint256_max(uint128_t((uint64_t)-1, (uint64_t)-1), uint128_t((uint64_t)-1, (uint64_t)-1));
-
-uint256_t::uint256_t(const std::string& s)
-{
-    init(s.c_str());
-}
-
-uint256_t::uint256_t(const char* s)
+namespace uint256_detail
 {
-    init(s);
-}
 
-uint256_t::uint256_t(const std::string& s, uint8_t base)
-{
-    init_from_base(s.c_str(), base);
-}
+inline constexpr char DIGITS[] = "0123456789abcdefghijklmnopqrstuvwxyz";
 
-uint256_t::uint256_t(const char* s, uint8_t base)
-{
-    init_from_base(s, base);
-}
+inline constexpr char DIGIT_PAIRS[] = "00010203040506070809"
+                           "10111213141516171819"
+                           "20212223242526272829"
+                           "30313233343536373839"
+                           "40414243444546474849"
+                           "50515253545556575859"
+                           "60616263646566676869"
+                           "70717273747576777879"
+                           "80818283848586878889"
+                           "90919293949596979899";
 
-uint256_t::uint256_t(const bool& b)
-  : uint256_t((uint8_t)b)
+// Largest power of a base that fits in one limb, and how many digits it covers
+struct Chunk
 {
-}
+    uint64_t divisor;
+    int digits;
+};
 
-void uint256_t::init(const char* s)
+inline const Chunk& chunk_for(const int base)
 {
-    // create from string
-    char buffer[64];
-    if (s == NULL)
+    static const struct Table
     {
-        uint256_t();
-        return;
-    }
-    if (s[1] == 'x')
-        s += 2;
-    else if (*s == 'x')
-        s++;
-
-    int len = strlen(s);
-    int padLength = 0;
-    if (len < 64)
-    {
-        padLength = 64 - len;
-        memset(buffer, '0', padLength);
-    }
-
-    memcpy(buffer + padLength, s, len);
-
-    UPPER = uint128_t(buffer);
-    LOWER = uint128_t(buffer + 32);
-}
-
-void uint256_t::init_from_base(const char* s, uint8_t base)
-{
-    *this = 0;
-
-    uint256_t power(1);
-    uint8_t digit;
-    int pos = strlen(s) - 1;
-    while (pos >= 0)
-    {
-        digit = 0;
-        if ('0' <= s[pos] && s[pos] <= '9')
+        Chunk chunks[37];
+        Table()
+          : chunks()
         {
-            digit = s[pos] - '0';
+            for (uint64_t b = 2; b <= 36; b++)
+            {
+                chunks[b] = {b, 1};
+                while (chunks[b].divisor <= UINT64_MAX / b)
+                {
+                    chunks[b].divisor *= b;
+                    chunks[b].digits++;
+                }
+            }
         }
-        else if ('a' <= s[pos] && s[pos] <= 'z')
-        {
-            digit = s[pos] - 'a' + 10;
-        }
-        *this += digit * power;
-        pos--;
-        power *= base;
-    }
-}
-
-uint256_t& uint256_t::operator=(const bool& rhs)
-{
-    UPPER = 0;
-    LOWER = rhs;
-    return *this;
-}
-
-uint256_t::operator bool() const
-{
-    return (bool)(UPPER | LOWER);
+    } table;
+    return table.chunks[base];
 }
 
-uint256_t::operator uint8_t() const
+// Value of a digit in base 36, 0xff for anything that is not a digit. Computed rather than looked up, so
+// that parsing works in the static initializers of other translation units too
+inline constexpr uint8_t digit_value(const char c)
 {
-    return (uint8_t)LOWER;
+    return ('0' <= c && c <= '9')   ? c - '0'
+           : ('a' <= c && c <= 'z') ? c - 'a' + 10
+           : ('A' <= c && c <= 'Z') ? c - 'A' + 10
+                                    : 0xff;
 }
 
-uint256_t::operator uint16_t() const
+// Writes all digits of value, most significant first, ending at end. Returns the first digit written
+inline char* write_digits(char* end, uint64_t value, const int base, int digits)
 {
-    return (uint16_t)LOWER;
-}
-
-uint256_t::operator uint32_t() const
-{
-    return (uint32_t)LOWER;
-}
-
-uint256_t::operator uint64_t() const
-{
-    return (uint64_t)LOWER;
-}
-
-uint256_t::operator uint128_t() const
-{
-    return LOWER;
-}
-
-uint256_t uint256_t::operator&(const uint128_t& rhs) const
-{
-    return uint256_t(uint128_0, LOWER & rhs);
-}
-
-uint256_t uint256_t::operator&(const uint256_t& rhs) const
-{
-    return uint256_t(UPPER & rhs.UPPER, LOWER & rhs.LOWER);
-}
-
-uint256_t& uint256_t::operator&=(const uint128_t& rhs)
-{
-    UPPER = uint128_0;
-    LOWER &= rhs;
-    return *this;
-}
-
-uint256_t& uint256_t::operator&=(const uint256_t& rhs)
-{
-    UPPER &= rhs.UPPER;
-    LOWER &= rhs.LOWER;
-    return *this;
-}
-
-uint256_t uint256_t::operator|(const uint128_t& rhs) const
-{
-    return uint256_t(UPPER, LOWER | rhs);
-}
-
-uint256_t uint256_t::operator|(const uint256_t& rhs) const
-{
-    return uint256_t(UPPER | rhs.UPPER, LOWER | rhs.LOWER);
-}
-
-uint256_t& uint256_t::operator|=(const uint128_t& rhs)
-{
-    LOWER |= rhs;
-    return *this;
-}
-
-uint256_t& uint256_t::operator|=(const uint256_t& rhs)
-{
-    UPPER |= rhs.UPPER;
-    LOWER |= rhs.LOWER;
-    return *this;
-}
-
-uint256_t uint256_t::operator^(const uint128_t& rhs) const
-{
-    return uint256_t(UPPER, LOWER ^ rhs);
-}
-
-uint256_t uint256_t::operator^(const uint256_t& rhs) const
-{
-    return uint256_t(UPPER ^ rhs.UPPER, LOWER ^ rhs.LOWER);
-}
-
-uint256_t& uint256_t::operator^=(const uint128_t& rhs)
-{
-    LOWER ^= rhs;
-    return *this;
-}
-
-uint256_t& uint256_t::operator^=(const uint256_t& rhs)
-{
-    UPPER ^= rhs.UPPER;
-    LOWER ^= rhs.LOWER;
-    return *this;
-}
-
-uint256_t uint256_t::operator~() const
-{
-    return uint256_t(~UPPER, ~LOWER);
-}
-
-uint256_t uint256_t::operator<<(const uint128_t& rhs) const
-{
-    return *this << uint256_t(rhs);
-}
-
-uint256_t uint256_t::operator<<(const uint256_t& rhs) const
-{
-    const uint128_t shift = rhs.LOWER;
-    if (((bool)rhs.UPPER) || (shift >= uint128_256))
-    {
-        return uint256_0;
-    }
-    else if (shift == uint128_128)
-    {
-        return uint256_t(LOWER, uint128_0);
-    }
-    else if (shift == uint128_0)
-    {
-        return *this;
-    }
-    else if (shift < uint128_128)
-    {
-        return uint256_t((UPPER << shift) + (LOWER >> (uint128_128 - shift)), LOWER << shift);
-    }
-    else if ((uint128_256 > shift) && (shift > uint128_128))
+    if (base == 10)
     {
-        return uint256_t(LOWER << (shift - uint128_128), uint128_0);
+        for (; digits >= 2; digits -= 2)
+        {
+            const uint64_t pair = (value % 100) * 2;
+            value /= 100;
+            *--end = DIGIT_PAIRS[pair + 1];
+            *--end = DIGIT_PAIRS[pair];
+        }
     }
-    else
+    for (; digits > 0; digits--)
     {
-        return uint256_0;
+        *--end = DIGITS[value % base];
+        value /= base;
     }
+    return end;
 }
 
-uint256_t& uint256_t::operator<<=(const uint128_t& shift)
+// Digit count of a single limb, at least one
+inline int count_digits(uint64_t value, const int base)
 {
-    return *this <<= uint256_t(shift);
-}
-
-uint256_t& uint256_t::operator<<=(const uint256_t& shift)
-{
-    *this = *this << shift;
-    return *this;
-}
-
-uint256_t uint256_t::operator>>(const uint128_t& rhs) const
-{
-    return *this >> uint256_t(rhs);
+    int digits = 1;
+    while (value >= (uint64_t)base)
+    {
+        value /= base;
+        digits++;
+    }
+    return digits;
 }
 
-uint256_t uint256_t::operator>>(const uint256_t& rhs) const
+// The string constructors take the whole string or throw, as the literal parser does
+inline void check_parsed(const std::from_chars_result& result, const char* last)
 {
-    const uint128_t shift = rhs.LOWER;
-    if (((bool)rhs.UPPER) | (shift >= uint128_256))
-    {
-        return uint256_0;
-    }
-    else if (shift == uint128_128)
-    {
-        return uint256_t(UPPER);
-    }
-    else if (shift == uint128_0)
-    {
-        return *this;
-    }
-    else if (shift < uint128_128)
-    {
-        return uint256_t(UPPER >> shift, (UPPER << (uint128_128 - shift)) + (LOWER >> shift));
-    }
-    else if ((uint128_256 > shift) && (shift > uint128_128))
+    if (result.ec == std::errc::result_out_of_range)
     {
-        return uint256_t(UPPER >> (shift - uint128_128));
+        throw std::out_of_range("Error: uint256_t string does not fit in 256 bits");
     }
-    else
+    if ((result.ec != std::errc()) || (result.ptr != last))
     {
-        return uint256_0;
+        throw std::invalid_argument("Error: uint256_t string is not a number in the given base");
     }
 }
 
-uint256_t& uint256_t::operator>>=(const uint128_t& shift)
-{
-    return *this >>= uint256_t(shift);
-}
-
-uint256_t& uint256_t::operator>>=(const uint256_t& shift)
-{
-    *this = *this >> shift;
-    return *this;
-}
-
-bool uint256_t::operator!() const
-{
-    return !(bool)*this;
-}
-
-bool uint256_t::operator&&(const uint128_t& rhs) const
-{
-    return (*this && uint256_t(rhs));
-}
-
-bool uint256_t::operator&&(const uint256_t& rhs) const
-{
-    return ((bool)*this && (bool)rhs);
-}
-
-bool uint256_t::operator||(const uint128_t& rhs) const
-{
-    return (*this || uint256_t(rhs));
-}
-
-bool uint256_t::operator||(const uint256_t& rhs) const
-{
-    return ((bool)*this || (bool)rhs);
-}
-
-bool uint256_t::operator==(const uint128_t& rhs) const
-{
-    return (*this == uint256_t(rhs));
-}
+} // namespace uint256_detail
 
-bool uint256_t::operator==(const uint256_t& rhs) const
+UINT256_T_INLINE uint256_t::uint256_t(const std::string& s)
 {
-    return ((UPPER == rhs.UPPER) && (LOWER == rhs.LOWER));
+    init(s.c_str());
 }
 
-bool uint256_t::operator!=(const uint128_t& rhs) const
+UINT256_T_INLINE uint256_t::uint256_t(const char* s)
 {
-    return (*this != uint256_t(rhs));
+    init(s);
 }
 
-bool uint256_t::operator!=(const uint256_t& rhs) const
+UINT256_T_INLINE uint256_t::uint256_t(const std::string& s, uint8_t base)
 {
-    return ((UPPER != rhs.UPPER) | (LOWER != rhs.LOWER));
+    init_from_base(s.c_str(), base);
 }
 
-bool uint256_t::operator>(const uint128_t& rhs) const
+UINT256_T_INLINE uint256_t::uint256_t(const char* s, uint8_t base)
 {
-    return (*this > uint256_t(rhs));
+    init_from_base(s, base);
 }
 
-bool uint256_t::operator>(const uint256_t& rhs) const
+UINT256_T_INLINE void uint256_t::init(const char* s)
 {
-    if (UPPER == rhs.UPPER)
+    // create from hex string
+    *this = uint256_0;
+    if (s == NULL)
     {
-        return (LOWER > rhs.LOWER);
+        return;
     }
-    if (UPPER > rhs.UPPER)
+    if (s[0] && s[1] == 'x')
+        s += 2;
+    else if (*s == 'x')
+        s++;
+
+    // An empty string is zero
+    const char* const last = s + strlen(s);
+    if (s != last)
     {
-        return true;
+        uint256_detail::check_parsed(from_chars(s, last, *this, 16), last);
     }
-    return false;
 }
 
-bool uint256_t::operator<(const uint128_t& rhs) const
+UINT256_T_INLINE void uint256_t::init_from_base(const char* s, uint8_t base)
 {
-    return (*this < uint256_t(rhs));
-}
-
-bool uint256_t::operator<(const uint256_t& rhs) const
-{
-    if (UPPER == rhs.UPPER)
+    if ((base < 2) || (base > 36))
     {
-        return (LOWER < rhs.LOWER);
+        throw std::invalid_argument("Base must be in the range 2-36");
     }
-    if (UPPER < rhs.UPPER)
+
+    *this = uint256_0;
+    const char* const last = s + strlen(s);
+    if (s != last)
     {
-        return true;
+        uint256_detail::check_parsed(from_chars(s, last, *this, base), last);
     }
-    return false;
-}
-
-bool uint256_t::operator>=(const uint128_t& rhs) const
-{
-    return (*this >= uint256_t(rhs));
 }
 
-bool uint256_t::operator>=(const uint256_t& rhs) const
+UINT256_T_INLINE std::vector<uint8_t> uint256_t::export_bits() const
 {
-    return ((*this > rhs) | (*this == rhs));
+    std::array<uint8_t, 32> bytes = {};
+    write_be(bytes);
+    return std::vector<uint8_t>(bytes.begin(), bytes.end());
 }
 
-bool uint256_t::operator<=(const uint128_t& rhs) const
+UINT256_T_INLINE std::vector<uint8_t> uint256_t::export_bits_truncate() const
 {
-    return (*this <= uint256_t(rhs));
-}
-
-bool uint256_t::operator<=(const uint256_t& rhs) const
-{
-    return ((*this < rhs) | (*this == rhs));
-}
-
-uint256_t uint256_t::operator+(const uint128_t& rhs) const
-{
-    return *this + uint256_t(rhs);
-}
-
-uint256_t uint256_t::operator+(const uint256_t& rhs) const
-{
-    return uint256_t(UPPER + rhs.UPPER + (((LOWER + rhs.LOWER) < LOWER) ? uint128_1 : uint128_0), LOWER + rhs.LOWER);
-}
+    std::array<uint8_t, 32> bytes = {};
+    write_be(bytes);
 
-uint256_t& uint256_t::operator+=(const uint128_t& rhs)
-{
-    return *this += uint256_t(rhs);
-}
-
-uint256_t& uint256_t::operator+=(const uint256_t& rhs)
-{
-    UPPER = rhs.UPPER + UPPER + ((LOWER + rhs.LOWER) < LOWER);
-    LOWER = LOWER + rhs.LOWER;
-    return *this;
-}
-
-uint256_t uint256_t::operator-(const uint128_t& rhs) const
-{
-    return *this - uint256_t(rhs);
-}
-
-uint256_t uint256_t::operator-(const uint256_t& rhs) const
-{
-    return uint256_t(UPPER - rhs.UPPER - ((LOWER - rhs.LOWER) > LOWER), LOWER - rhs.LOWER);
-}
-
-uint256_t& uint256_t::operator-=(const uint128_t& rhs)
-{
-    return *this -= uint256_t(rhs);
-}
-
-uint256_t& uint256_t::operator-=(const uint256_t& rhs)
-{
-    *this = *this - rhs;
-    return *this;
-}
-
-uint256_t uint256_t::operator*(const uint128_t& rhs) const
-{
-    return *this * uint256_t(rhs);
+    // prune the zeroes
+    const std::size_t zeroes = leading_zeros() / 8;
+    return std::vector<uint8_t>(bytes.begin() + zeroes, bytes.end());
 }
 
-uint256_t uint256_t::operator*(const uint256_t& rhs) const
+UINT256_T_INLINE std::string uint256_t::str(uint8_t base, const unsigned int& len) const
 {
-    // split values into 4 64-bit parts
-    uint128_t top[4] = {UPPER.upper(), UPPER.lower(), LOWER.upper(), LOWER.lower()};
-    uint128_t bottom[4] = {rhs.upper().upper(), rhs.upper().lower(), rhs.lower().upper(), rhs.lower().lower()};
-    uint128_t products[4][4];
-
-    // multiply each component of the values
-    for (int y = 3; y > -1; y--)
+    if ((base < 2) || (base > 36))
     {
-        for (int x = 3; x > -1; x--)
-        {
-            products[3 - y][x] = top[x] * bottom[y];
-        }
+        throw std::invalid_argument("Base must be in the range 2-36");
     }
 
-    // first row
-    uint128_t fourth64 = uint128_t(products[0][3].lower());
-    uint128_t third64 = uint128_t(products[0][2].lower()) + uint128_t(products[0][3].upper());
-    uint128_t second64 = uint128_t(products[0][1].lower()) + uint128_t(products[0][2].upper());
-    uint128_t first64 = uint128_t(products[0][0].lower()) + uint128_t(products[0][1].upper());
-
-    // second row
-    third64 += uint128_t(products[1][3].lower());
-    second64 += uint128_t(products[1][2].lower()) + uint128_t(products[1][3].upper());
-    first64 += uint128_t(products[1][1].lower()) + uint128_t(products[1][2].upper());
-
-    // third row
-    second64 += uint128_t(products[2][3].lower());
-    first64 += uint128_t(products[2][2].lower()) + uint128_t(products[2][3].upper());
-
-    // fourth row
-    first64 += uint128_t(products[3][3].lower());
-
-    // combines the values, taking care of carry over
-    return uint256_t(first64 << uint128_64, uint128_0) + uint256_t(third64.upper(), third64 << uint128_64) +
-           uint256_t(second64, uint128_0) + uint256_t(fourth64);
-}
-
-uint256_t& uint256_t::operator*=(const uint128_t& rhs)
-{
-    return *this *= uint256_t(rhs);
+    char buffer[256];
+    const std::to_chars_result result = to_chars(buffer, buffer + sizeof(buffer), *this, base);
+    const unsigned int size = result.ptr - buffer;
+    std::string out;
+    out.reserve(size < len ? len : size);
+    if (size < len)
+    {
+        out.append(len - size, '0');
+    }
+    out.append(buffer, size);
+    return out;
 }
 
-uint256_t& uint256_t::operator*=(const uint256_t& rhs)
-{
-    *this = *this * rhs;
-    return *this;
-}
 
-std::pair<uint256_t, uint256_t> uint256_t::divmod(const uint256_t& lhs, const uint256_t& rhs) const
+UINT256_T_INLINE std::to_chars_result to_chars(char* first, char* last, const uint256_t& value, int base)
 {
-    // Save some calculations /////////////////////
-    if (rhs == uint256_0)
-    {
-        throw std::domain_error("Error: division or modulus by 0");
-    }
-    else if (rhs == uint256_1)
-    {
-        return std::pair<uint256_t, uint256_t>(lhs, uint256_0);
-    }
-    else if (lhs == rhs)
-    {
-        return std::pair<uint256_t, uint256_t>(uint256_1, uint256_0);
-    }
-    else if ((lhs == uint256_0) || (lhs < rhs))
+    if ((base < 2) || (base > 36))
     {
-        return std::pair<uint256_t, uint256_t>(uint256_0, lhs);
+        return {last, std::errc::invalid_argument};
     }
 
-    std::pair<uint256_t, uint256_t> qr(uint256_0, lhs);
-    uint256_t copyd = rhs << (lhs.bits() - rhs.bits());
-    uint256_t adder = uint256_1 << (lhs.bits() - rhs.bits());
-    if (copyd > qr.second)
+    // Digits are produced least significant first into the tail of a scratch buffer
+    char buffer[256];
+    char* const end = buffer + sizeof(buffer);
+    char* begin = end;
+
+    if (!(base & (base - 1)))
     {
-        copyd >>= uint256_1;
-        adder >>= uint256_1;
+        // Power of two bases read their digits straight out of the limbs
+        const unsigned int width = uint256_limbs::ctz(base);
+        const unsigned int bits = value.bits();
+        unsigned int offset = 0;
+        do
+        {
+            *--begin = uint256_detail::DIGITS[value.bit_window(offset, width)];
+            offset += width;
+        } while (offset < bits);
     }
-    while (qr.second >= rhs)
+    else
     {
-        if (qr.second >= copyd)
+        // Peel off one limb sized chunk per division, then split each chunk with native arithmetic
+        const uint256_detail::Chunk& chunk = uint256_detail::chunk_for(base);
+        std::pair<uint256_t, uint64_t> qr(value, 0);
+        while (true)
         {
-            qr.second -= copyd;
-            qr.first |= adder;
+            qr = qr.first.divmod_word(chunk.divisor);
+            if (!qr.first)
+            {
+                const int digits = uint256_detail::count_digits(qr.second, base);
+                begin = uint256_detail::write_digits(begin, qr.second, base, digits);
+                break;
+            }
+            begin = uint256_detail::write_digits(begin, qr.second, base, chunk.digits);
         }
-        copyd >>= uint256_1;
-        adder >>= uint256_1;
     }
-    return qr;
-}
 
-uint256_t uint256_t::operator/(const uint128_t& rhs) const
-{
-    return *this / uint256_t(rhs);
-}
-
-uint256_t uint256_t::operator/(const uint256_t& rhs) const
-{
-    return divmod(*this, rhs).first;
-}
-
-uint256_t& uint256_t::operator/=(const uint128_t& rhs)
-{
-    return *this /= uint256_t(rhs);
-}
-
-uint256_t& uint256_t::operator/=(const uint256_t& rhs)
-{
-    *this = *this / rhs;
-    return *this;
-}
-
-uint256_t uint256_t::operator%(const uint128_t& rhs) const
-{
-    return *this % uint256_t(rhs);
-}
-
-uint256_t uint256_t::operator%(const uint256_t& rhs) const
-{
-    return *this - (rhs * (*this / rhs));
-}
-
-uint256_t& uint256_t::operator%=(const uint128_t& rhs)
-{
-    return *this %= uint256_t(rhs);
-}
-
-uint256_t& uint256_t::operator%=(const uint256_t& rhs)
-{
-    *this = *this % rhs;
-    return *this;
-}
-
-uint256_t& uint256_t::operator++()
-{
-    *this += uint256_1;
-    return *this;
-}
-
-uint256_t uint256_t::operator++(int)
-{
-    uint256_t temp(*this);
-    ++*this;
-    return temp;
-}
-
-uint256_t& uint256_t::operator--()
-{
-    *this -= uint256_1;
-    return *this;
-}
-
-uint256_t uint256_t::operator--(int)
-{
-    uint256_t temp(*this);
-    --*this;
-    return temp;
-}
-
-uint256_t uint256_t::operator+() const
-{
-    return *this;
-}
-
-uint256_t uint256_t::operator-() const
-{
-    return ~*this + uint256_1;
-}
-
-const uint128_t& uint256_t::upper() const
-{
-    return UPPER;
-}
-
-const uint128_t& uint256_t::lower() const
-{
-    return LOWER;
-}
-
-std::vector<uint8_t> uint256_t::export_bits() const
-{
-    std::vector<uint8_t> ret;
-    ret.reserve(32);
-    UPPER.export_bits(ret);
-    LOWER.export_bits(ret);
-    return ret;
+    const std::ptrdiff_t size = end - begin;
+    if (last - first < size)
+    {
+        return {last, std::errc::value_too_large};
+    }
+    memcpy(first, begin, size);
+    return {first + size, std::errc()};
 }
 
-std::vector<uint8_t> uint256_t::export_bits_truncate() const
+UINT256_T_INLINE std::from_chars_result from_chars(const char* first, const char* last, uint256_t& value, int base)
 {
-    std::vector<uint8_t> ret = export_bits();
-
-    // prune the zeroes
-    int i = 0;
-    while (ret[i] == 0 && i < 64)
-        i++;
-    ret.erase(ret.begin(), ret.begin() + i);
-
-    return ret;
-}
+    if ((base < 2) || (base > 36))
+    {
+        return {first, std::errc::invalid_argument};
+    }
 
-uint16_t uint256_t::bits() const
-{
-    uint16_t out = 0;
-    if (UPPER)
+    // Gather a limb sized chunk of digits, then fold it in with one fused multiply-add pass
+    const uint256_detail::Chunk& chunk = uint256_detail::chunk_for(base);
+    uint256_t out(uint256_0);
+    bool overflow = false;
+    const char* p = first;
+    while (p != last)
     {
-        out = 128;
-        uint128_t up = UPPER;
-        while (up)
+        uint64_t digits = 0;
+        uint64_t scale = 1;
+        int count = 0;
+        for (; (p != last) && (count < chunk.digits); p++, count++)
         {
-            up >>= uint128_1;
-            out++;
+            const uint8_t digit = uint256_detail::digit_value(*p);
+            if (digit >= base)
+            {
+                break;
+            }
+            digits = digits * base + digit;
+            scale *= base;
         }
-    }
-    else
-    {
-        uint128_t low = LOWER;
-        while (low)
+        if (!count)
         {
-            low >>= uint128_1;
-            out++;
+            break;
         }
-    }
-    return out;
-}
 
-std::string uint256_t::str(uint8_t base, const unsigned int& len) const
-{
-    if ((base < 2) || (base > 36))
-    {
-        throw std::invalid_argument("Base must be in the range 2-36");
-    }
-    std::string out = "";
-    if (!(*this))
-    {
-        out = "0";
+        uint64_t carry = digits;
+        for (int i = 0; i < 4; i++)
+        {
+            uint64_t high = 0;
+            uint64_t c = 0;
+            out.LIMBS[i] = uint256_limbs::addc(uint256_limbs::mul(out.LIMBS[i], scale, high), carry, 0, c);
+            carry = high + c;
+        }
+        overflow |= (carry != 0);
+
+        if (count < chunk.digits)
+        {
+            break;
+        }
     }
-    else
+
+    if (p == first)
     {
-        std::pair<uint256_t, uint256_t> qr(*this, uint256_0);
-        do
-        {
-            qr = divmod(qr.first, base);
-            out = "0123456789abcdefghijklmnopqrstuvwxyz"[(uint8_t)qr.second] + out;
-        } while (qr.first);
+        return {first, std::errc::invalid_argument};
     }
-    if (out.size() < len)
+    if (overflow)
     {
-        out = std::string(len - out.size(), '0') + out;
+        return {p, std::errc::result_out_of_range};
     }
-    return out;
+    value = out;
+    return {p, std::errc()};
 }
 
-uint256_t operator&(const uint128_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint256_t operator&(const uint128_t& lhs, const uint256_t& rhs)
 {
     return rhs & lhs;
 }
 
-uint128_t& operator&=(uint128_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint128_t& operator&=(uint128_t& lhs, const uint256_t& rhs)
 {
     lhs = (rhs & lhs).lower();
     return lhs;
 }
 
-uint256_t operator|(const uint128_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint256_t operator|(const uint128_t& lhs, const uint256_t& rhs)
 {
     return rhs | lhs;
 }
 
-uint128_t& operator|=(uint128_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint128_t& operator|=(uint128_t& lhs, const uint256_t& rhs)
 {
     lhs = (rhs | lhs).lower();
     return lhs;
 }
 
-uint256_t operator^(const uint128_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint256_t operator^(const uint128_t& lhs, const uint256_t& rhs)
 {
     return rhs ^ lhs;
 }
 
-uint128_t& operator^=(uint128_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint128_t& operator^=(uint128_t& lhs, const uint256_t& rhs)
 {
     lhs = (rhs ^ lhs).lower();
     return lhs;
 }
 
-uint256_t operator<<(const bool& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint256_t operator<<(const bool& lhs, const uint256_t& rhs)
 {
     return uint256_t(lhs) << rhs;
 }
 
-uint256_t operator<<(const uint8_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint256_t operator<<(const uint8_t& lhs, const uint256_t& rhs)
 {
     return uint256_t(lhs) << rhs;
 }
 
-uint256_t operator<<(const uint16_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint256_t operator<<(const uint16_t& lhs, const uint256_t& rhs)
 {
     return uint256_t(lhs) << rhs;
 }
 
-uint256_t operator<<(const uint32_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint256_t operator<<(const uint32_t& lhs, const uint256_t& rhs)
 {
     return uint256_t(lhs) << rhs;
 }
 
-uint256_t operator<<(const uint64_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint256_t operator<<(const uint64_t& lhs, const uint256_t& rhs)
 {
     return uint256_t(lhs) << rhs;
 }
 
-uint256_t operator<<(const uint128_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint256_t operator<<(const uint128_t& lhs, const uint256_t& rhs)
 {
     return uint256_t(lhs) << rhs;
 }
 
-uint256_t operator<<(const int8_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint256_t operator<<(const int8_t& lhs, const uint256_t& rhs)
 {
     return uint256_t(lhs) << rhs;
 }
 
-uint256_t operator<<(const int16_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint256_t operator<<(const int16_t& lhs, const uint256_t& rhs)
 {
     return uint256_t(lhs) << rhs;
 }
 
-uint256_t operator<<(const int32_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint256_t operator<<(const int32_t& lhs, const uint256_t& rhs)
 {
     return uint256_t(lhs) << rhs;
 }
 
-uint256_t operator<<(const int64_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint256_t operator<<(const int64_t& lhs, const uint256_t& rhs)
 {
     return uint256_t(lhs) << rhs;
 }
 
-uint128_t& operator<<=(uint128_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint128_t& operator<<=(uint128_t& lhs, const uint256_t& rhs)
 {
     lhs = (uint256_t(lhs) << rhs).lower();
     return lhs;
 }
 
-uint256_t operator>>(const bool& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint256_t operator>>(const bool& lhs, const uint256_t& rhs)
 {
     return uint256_t(lhs) >> rhs;
 }
 
-uint256_t operator>>(const uint8_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint256_t operator>>(const uint8_t& lhs, const uint256_t& rhs)
 {
     return uint256_t(lhs) >> rhs;
 }
 
-uint256_t operator>>(const uint16_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint256_t operator>>(const uint16_t& lhs, const uint256_t& rhs)
 {
     return uint256_t(lhs) >> rhs;
 }
 
-uint256_t operator>>(const uint32_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint256_t operator>>(const uint32_t& lhs, const uint256_t& rhs)
 {
     return uint256_t(lhs) >> rhs;
 }
 
-uint256_t operator>>(const uint64_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint256_t operator>>(const uint64_t& lhs, const uint256_t& rhs)
 {
     return uint256_t(lhs) >> rhs;
 }
 
-uint256_t operator>>(const uint128_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint256_t operator>>(const uint128_t& lhs, const uint256_t& rhs)
 {
     return uint256_t(lhs) >> rhs;
 }
 
-uint256_t operator>>(const int8_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint256_t operator>>(const int8_t& lhs, const uint256_t& rhs)
 {
     return uint256_t(lhs) >> rhs;
 }
 
-uint256_t operator>>(const int16_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint256_t operator>>(const int16_t& lhs, const uint256_t& rhs)
 {
     return uint256_t(lhs) >> rhs;
 }
 
-uint256_t operator>>(const int32_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint256_t operator>>(const int32_t& lhs, const uint256_t& rhs)
 {
     return uint256_t(lhs) >> rhs;
 }
 
-uint256_t operator>>(const int64_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint256_t operator>>(const int64_t& lhs, const uint256_t& rhs)
 {
     return uint256_t(lhs) >> rhs;
 }
 
-uint128_t& operator>>=(uint128_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint128_t& operator>>=(uint128_t& lhs, const uint256_t& rhs)
 {
     lhs = (uint256_t(lhs) >> rhs).lower();
     return lhs;
 }
 
 // Comparison Operators
-bool operator==(const uint128_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE bool operator==(const uint128_t& lhs, const uint256_t& rhs)
 {
     return rhs == lhs;
 }
 
-bool operator!=(const uint128_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE bool operator!=(const uint128_t& lhs, const uint256_t& rhs)
 {
     return rhs != lhs;
 }
 
-bool operator>(const uint128_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE bool operator>(const uint128_t& lhs, const uint256_t& rhs)
 {
     return rhs < lhs;
 }
 
-bool operator<(const uint128_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE bool operator<(const uint128_t& lhs, const uint256_t& rhs)
 {
     return rhs > lhs;
 }
 
-bool operator>=(const uint128_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE bool operator>=(const uint128_t& lhs, const uint256_t& rhs)
 {
     return rhs <= lhs;
 }
 
-bool operator<=(const uint128_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE bool operator<=(const uint128_t& lhs, const uint256_t& rhs)
 {
     return rhs >= lhs;
 }
 
 // Arithmetic Operators
-uint256_t operator+(const uint128_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint256_t operator+(const uint128_t& lhs, const uint256_t& rhs)
 {
     return rhs + lhs;
 }
 
-uint128_t& operator+=(uint128_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint128_t& operator+=(uint128_t& lhs, const uint256_t& rhs)
 {
     lhs = (rhs + lhs).lower();
     return lhs;
 }
 
-uint256_t operator-(const uint128_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint256_t operator-(const uint128_t& lhs, const uint256_t& rhs)
 {
     return -(rhs - lhs);
 }
 
-uint128_t& operator-=(uint128_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint128_t& operator-=(uint128_t& lhs, const uint256_t& rhs)
 {
     lhs = (-(rhs - lhs)).lower();
     return lhs;
 }
 
-uint256_t operator*(const uint128_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint256_t operator*(const uint128_t& lhs, const uint256_t& rhs)
 {
     return rhs * lhs;
 }
 
-uint128_t& operator*=(uint128_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint128_t& operator*=(uint128_t& lhs, const uint256_t& rhs)
 {
     lhs = (rhs * lhs).lower();
     return lhs;
 }
 
-uint256_t operator/(const uint128_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint256_t operator/(const uint128_t& lhs, const uint256_t& rhs)
 {
     return uint256_t(lhs) / rhs;
 }
 
-uint128_t& operator/=(uint128_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint128_t& operator/=(uint128_t& lhs, const uint256_t& rhs)
 {
     lhs = (uint256_t(lhs) / rhs).lower();
     return lhs;
 }
 
-uint256_t operator%(const uint128_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint256_t operator%(const uint128_t& lhs, const uint256_t& rhs)
 {
     return uint256_t(lhs) % rhs;
 }
 
-uint128_t& operator%=(uint128_t& lhs, const uint256_t& rhs)
+UINT256_T_INLINE uint128_t& operator%=(uint128_t& lhs, const uint256_t& rhs)
 {
     lhs = (uint256_t(lhs) % rhs).lower();
     return lhs;
 }
 
-std::ostream& operator<<(std::ostream& stream, const uint256_t& rhs)
+UINT256_T_INLINE std::ostream& operator<<(std::ostream& stream, const uint256_t& rhs)
 {
+    int base = 0;
     if (stream.flags() & stream.oct)
     {
-        stream << rhs.str(8);
+        base = 8;
     }
     else if (stream.flags() & stream.dec)
     {
-        stream << rhs.str(10);
+        base = 10;
     }
     else if (stream.flags() & stream.hex)
     {
-        stream << rhs.str(16);
+        base = 16;
+    }
+
+    if (base)
+    {
+        char buffer[256];
+        const std::to_chars_result result = to_chars(buffer, buffer + sizeof(buffer), rhs, base);
+        stream.write(buffer, result.ptr - buffer);
     }
     return stream;
 }
@@ -0,0 +1,6 @@
+#include "uint512_t.hpp"
+
+UINT256_T_INLINE uint256_t mulmod(const uint256_t& lhs, const uint256_t& rhs, const uint256_t& mod)
+{
+    return uint512_t(lhs.mul_wide(rhs)) % mod;
+}
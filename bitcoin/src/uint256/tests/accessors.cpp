@@ -18,4 +18,52 @@ TEST(Accessor, data){
     EXPECT_EQ(value.upper().lower(), 0x0123456789abcdefULL);
     EXPECT_EQ(value.lower().upper(), 0xfedcba9876543210ULL);
     EXPECT_EQ(value.lower().lower(), 0x0123456789abcdefULL);
+
+    EXPECT_EQ(value.limb(3), 0xfedcba9876543210ULL);
+    EXPECT_EQ(value.limb(2), 0x0123456789abcdefULL);
+    EXPECT_EQ(value.limb(1), 0xfedcba9876543210ULL);
+    EXPECT_EQ(value.limb(0), 0x0123456789abcdefULL);
+}
+
+TEST(Accessor, bit_queries){
+    const uint256_t value(0x8000000000000000ULL, 0x0000000000000000ULL, 0x00000000000000f0ULL, 0x0000000000000000ULL);
+    EXPECT_EQ(value.leading_zeros(), 0);
+    EXPECT_EQ(value.trailing_zeros(), 68);
+    EXPECT_EQ(value.popcount(), 5);
+    EXPECT_EQ((value >> 1).leading_zeros(), 1);
+    EXPECT_EQ((value >> 100).leading_zeros(), 100);
+
+    EXPECT_EQ(uint256_t(0).leading_zeros(), 256);
+    EXPECT_EQ(uint256_t(0).trailing_zeros(), 256);
+    EXPECT_EQ(uint256_t(0).popcount(), 0);
+    EXPECT_EQ(uint256_max.popcount(), 256);
+
+    for(unsigned int bit = 0; bit < 256; bit++){
+        const uint256_t single = uint256_1 << bit;
+        EXPECT_EQ(single.leading_zeros(), 255 - bit);
+        EXPECT_EQ(single.trailing_zeros(), bit);
+        EXPECT_EQ(single.popcount(), 1);
+        EXPECT_TRUE(single.test_bit(bit));
+        EXPECT_EQ(value.test_bit(bit), (bool) ((value >> bit) & 1));
+    }
+    EXPECT_FALSE(uint256_max.test_bit(256));
+}
+
+TEST(Accessor, bit_window){
+    const uint256_t value(0x0123456789abcdefULL, 0xfedcba9876543210ULL, 0x0123456789abcdefULL, 0xfedcba9876543210ULL);
+
+    // windows that straddle limbs match a shift and mask
+    for(unsigned int offset = 0; offset < 256; offset += 3){
+        for(unsigned int width = 1; width <= 64; width += 7){
+            const uint256_t expected = (value >> offset) & ((uint256_1 << width) - 1);
+            EXPECT_EQ(value.bit_window(offset, width), (uint64_t) expected);
+        }
+    }
+
+    EXPECT_EQ(value.bit_window(60, 8), 0xffULL);
+    EXPECT_EQ(value.bit_window(252, 8), 0x0ULL);
+    EXPECT_EQ(value.bit_window(0, 64), 0xfedcba9876543210ULL);
+    EXPECT_EQ(value.bit_window(64, 64), 0x0123456789abcdefULL);
+    EXPECT_EQ(value.bit_window(256, 4), 0ULL);
+    EXPECT_EQ(value.bit_window(4, 0), 0ULL);
 }
@@ -15,6 +15,15 @@ TEST(Arithmetic, add){
     EXPECT_EQ(high += low,  uint256_t(2, 2));
 }
 
+TEST(Arithmetic, add_carry){
+    const uint256_t ones(0x0000000000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL);
+
+    // carry ripples through every limb
+    EXPECT_EQ(ones + 1, uint256_t(0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL));
+    EXPECT_EQ(uint256_max + 1, 0);
+    EXPECT_EQ(uint256_max + uint256_max, uint256_t(0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xfffffffffffffffeULL));
+}
+
 TEST(External, add){
     bool     t     = true;
     bool     f     = false;
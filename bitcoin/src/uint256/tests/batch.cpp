@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "uint256_t.h"
+#include "uint256_batch.hpp"
+
+namespace {
+    // secp256k1 field prime
+    const uint256_t p(0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xfffffffefffffc2fULL);
+
+    // 11 values, so that both the four wide kernels and the leftover scalar loop are used
+    std::vector<uint256_t> values(const uint256_t & seed){
+        std::vector<uint256_t> out;
+        uint256_t x = seed;
+        for(int i = 0; i < 11; i++){
+            out.push_back(x % p);
+            x = x * uint256_t(0x9e3779b97f4a7c15ULL) + uint256_t(0xffffffffffffffffULL, 0xffffffffffffffffULL) + i;
+        }
+        out[3] = p - 1;
+        out[4] = 0;
+        return out;
+    }
+
+    uint256_t add_mod(const uint256_t & a, const uint256_t & b){
+        const uint256_t sum = a + b;
+        return (sum < a || sum >= p) ? sum - p : sum;
+    }
+}
+
+TEST(Batch, access){
+    uint256_batch_t batch(values(1));
+    EXPECT_EQ(batch.size(), 11);
+    EXPECT_EQ(batch.get(3), p - 1);
+    batch.set(3, uint256_max);
+    EXPECT_EQ(batch.get(3), uint256_max);
+
+    uint256_batch_t out;
+    EXPECT_THROW(uint256_batch_t::add(out, batch, uint256_batch_t(10)), std::invalid_argument);
+}
+
+TEST(Batch, kernels){
+    const std::vector<uint256_t> a = values(uint256_t(0x0123456789abcdefULL, 0xfedcba9876543210ULL));
+    const std::vector<uint256_t> b = values(uint256_t(0xfedcba9876543210ULL, 0x0123456789abcdefULL, 0, 0));
+    const uint256_batch_t lhs(a), rhs(b);
+
+    // the same results with and without AVX2
+    for(const bool avx2 : {true, false}){
+        uint256_batch_t::use_avx2(avx2);
+
+        uint256_batch_t sum, difference, modsum, moddifference, selected;
+        std::vector<uint64_t> mask;
+        uint256_batch_t::add(sum, lhs, rhs);
+        uint256_batch_t::sub(difference, lhs, rhs);
+        uint256_batch_t::add_mod(modsum, lhs, rhs, p);
+        uint256_batch_t::sub_mod(moddifference, lhs, rhs, p);
+        uint256_batch_t::less(mask, lhs, rhs);
+        uint256_batch_t::select(selected, mask, lhs, rhs);
+
+        for(std::size_t i = 0; i < a.size(); i++){
+            EXPECT_EQ(sum.get(i), a[i] + b[i]);
+            EXPECT_EQ(difference.get(i), a[i] - b[i]);
+            EXPECT_EQ(modsum.get(i), add_mod(a[i], b[i]));
+            EXPECT_EQ(moddifference.get(i), a[i] >= b[i] ? a[i] - b[i] : p - (b[i] - a[i]));
+            EXPECT_EQ(mask[i], a[i] < b[i] ? ~(uint64_t)0 : 0);
+            EXPECT_EQ(selected.get(i), a[i] < b[i] ? a[i] : b[i]);
+        }
+
+        // the output may be one of the inputs
+        uint256_batch_t inplace(lhs);
+        uint256_batch_t::add_mod(inplace, inplace, inplace, p);
+        for(std::size_t i = 0; i < a.size(); i++){
+            EXPECT_EQ(inplace.get(i), add_mod(a[i], a[i]));
+        }
+    }
+    uint256_batch_t::use_avx2(true);
+}
+
+TEST(Batch, switch_while_running){
+    const std::vector<uint256_t> a = values(uint256_t(0x0123456789abcdefULL, 0xfedcba9876543210ULL));
+    const uint256_batch_t lhs(a);
+
+    // switching kernels does not disturb operations running on other threads
+    bool correct = true;
+    std::thread worker([&](){
+        for(int round = 0; round < 1000; round++){
+            uint256_batch_t sum;
+            uint256_batch_t::add_mod(sum, lhs, lhs, p);
+            for(std::size_t i = 0; i < a.size(); i++){
+                correct = correct && (sum.get(i) == add_mod(a[i], a[i]));
+            }
+        }
+    });
+    for(int round = 0; round < 1000; round++){
+        uint256_batch_t::use_avx2(round % 2);
+    }
+    worker.join();
+    uint256_batch_t::use_avx2(true);
+    EXPECT_TRUE(correct);
+}
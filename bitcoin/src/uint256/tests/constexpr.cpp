@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+
+#include "uint256_t.h"
+
+// secp256k1 field prime and the x coordinate of its generator
+constexpr uint256_t P = 0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f_u256;
+constexpr uint256_t GX = 0x79be667e'f9dcbbac'55a06295'ce870b07'029bfcdb'2dce28d9'59f2815b'16f81798_u256;
+
+static_assert(P == uint256_t(0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xfffffffefffffc2fULL), "hex literal");
+static_assert(P + 0x1000003d1ULL == 0, "carry chain");
+static_assert(uint256_max + 1 == 0, "wrap around");
+static_assert(-uint256_1 == uint256_max, "negation");
+static_assert((GX >> 192) == 0x79be667ef9dcbbacULL, "shift right");
+static_assert((uint256_1 << 255) < P && (uint256_1 << 256) == 0, "shift left");
+static_assert(GX * 2 / 2 == GX, "multiply and divide by word");
+static_assert(GX % 0x10000 == 0x1798, "modulo by word");
+static_assert(P / GX == 2, "full width division");
+static_assert(P % GX == 0xc8333020c4688a754bf3ad462f1e9f1fac80649a463ae4d4c1afd48d20fccff_u256, "full width modulo");
+static_assert((P * P) % GX == 0x1000007a2000e90a1_u256, "truncated multiply");
+static_assert(P.bits() == 256 && GX.bits() == 255, "bits");
+static_assert(uint128_t(1, 0) * uint128_t(1, 0) == 0, "uint128_t multiply");
+static_assert(uint128_t(1, 0) / 3 == uint128_t(0x5555555555555555ULL), "uint128_t divide");
+
+TEST(Constexpr, literals){
+    EXPECT_EQ(P, uint256_t("fffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f", 16));
+    EXPECT_EQ(GX, uint256_t("79be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798", 16));
+
+    EXPECT_EQ(115792089237316195423570985008687907853269984665640564039457584007908834671663_u256, P);
+    EXPECT_EQ(0b1010_u256, 10);
+    EXPECT_EQ(017_u256, 15);
+    EXPECT_EQ(0_u256, 0);
+    EXPECT_EQ(0XABCDEF_u256, 0xabcdef);
+    EXPECT_EQ(1'000'000_u256, 1000000);
+}
+
+TEST(Constexpr, table){
+    // a table computed entirely by the compiler
+    constexpr uint256_t powers[] = {uint256_1, uint256_1 << 64, uint256_1 << 128, uint256_1 << 192};
+    for(int i = 0; i < 4; i++){
+        EXPECT_EQ(powers[i].bits(), 64 * i + 1);
+    }
+}
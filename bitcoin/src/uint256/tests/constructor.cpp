@@ -12,12 +12,20 @@ TEST(Constructor, standard){
     EXPECT_EQ(value, 0x0123456789abcdefULL);
 }
 
+// Parsed during static initialization, possibly before anything in the library's own translation units
+static const uint256_t STATIC_STRING("0xdeadbeef");
+
 TEST(Constructor, string){
     EXPECT_EQ(uint256_t("0xffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff"), uint256_max);
     EXPECT_EQ(uint256_t("ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff"), uint256_max);
     EXPECT_EQ(uint256_t("0x0"), 0);
     EXPECT_EQ(uint256_t("0"), 0);
     EXPECT_EQ(uint256_t("0x0123456789abcdef"), 0x0123456789abcdefULL);
+    EXPECT_EQ(uint256_t(""), 0);
+    EXPECT_EQ(STATIC_STRING, 0xdeadbeefULL);
+
+    EXPECT_THROW(uint256_t("0xdeadbeeg"), std::invalid_argument);
+    EXPECT_THROW(uint256_t("1ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff"), std::out_of_range);
 }
 
 TEST(Constructor, base_string){
@@ -28,6 +36,11 @@ TEST(Constructor, base_string){
     EXPECT_EQ(uint256_t("0123456789abcdef", 16), 0x0123456789abcdefULL);
     EXPECT_EQ(uint256_t("755", 8), 0x01ed);
     EXPECT_EQ(uint256_t("31415926", 10), 0x01df5e76ULL);
+
+    EXPECT_THROW(uint256_t("12a", 10), std::invalid_argument);
+    EXPECT_THROW(uint256_t(" 12", 10), std::invalid_argument);
+    EXPECT_THROW(uint256_t("115792089237316195423570985008687907853269984665640564039457584007913129639936", 10), std::out_of_range);
+    EXPECT_THROW(uint256_t("12", 37), std::invalid_argument);
 }
 
 TEST(Constructor, one){
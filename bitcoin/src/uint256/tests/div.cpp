@@ -15,6 +15,42 @@ TEST(Arithmetic, divide){
     EXPECT_THROW(uint256_t(1) / uint256_t(0), std::domain_error);
 }
 
+TEST(Arithmetic, divide_limbs){
+    // single limb divisor
+    EXPECT_EQ(uint256_max / uint256_t(0xffffffffffffffffULL), uint256_t(0x0000000000000001ULL, 0x0000000000000001ULL, 0x0000000000000001ULL, 0x0000000000000001ULL));
+
+    // multi limb divisors
+    EXPECT_EQ(uint256_max / uint256_t(1, 1), uint256_t(0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL));
+
+    const uint256_t big    (0xfedcba9876543210ULL, 0xfedcba9876543210ULL, 0xfedcba9876543210ULL, 0xfedcba9876543210ULL);
+    const uint256_t divisor(0x0000000000000000ULL, 0x0000000000000000ULL, 0x0123456789abcdefULL, 0x0123456789abcdefULL);
+    EXPECT_EQ(big / divisor, uint256_t(0x0000000000000000ULL, 0x00000000000000e0ULL, 0x000000000000d2f0ULL, 0x0000000000c694d0ULL));
+    EXPECT_EQ(big % divisor, uint256_t(0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000d4b3e0ULL, 0x0000000000d4b3e0ULL));
+
+    // the first quotient estimate is too large and has to be corrected
+    const uint256_t num(0x8000000000000000ULL, 0xfffffffffffffffeULL, 0x0000000000000000ULL, 0x0000000000000000ULL);
+    const uint256_t den(0x0000000000000000ULL, 0x8000000000000000ULL, 0x0000000000000001ULL, 0xffffffffffffffffULL);
+    EXPECT_EQ(num / den, uint256_t(0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000001ULL, 0x0000000000000001ULL));
+    EXPECT_EQ(num % den, uint256_t(0x0000000000000000ULL, 0x7ffffffffffffffbULL, 0xffffffffffffffffULL, 0x0000000000000001ULL));
+}
+
+TEST(Arithmetic, divide_word){
+    const uint256_t val(0xfedcba9876543210ULL, 0xfedcba9876543210ULL, 0xfedcba9876543210ULL, 0xfedcba9876543210ULL);
+
+    const std::pair<uint256_t, uint64_t> qr = val.divmod_word(0x0123456789abcdefULL);
+    EXPECT_EQ(qr.first, uint256_t(0x00000000000000e0ULL, 0x000000000000d3d0ULL, 0x0000000000c767c0ULL, 0x00000000bbb8acb0ULL));
+    EXPECT_EQ(qr.second, 0xc91209c0ULL);
+    EXPECT_EQ(val / 0x0123456789abcdefULL, qr.first);
+
+    // decimal printing divides by 10^19 chunks
+    const std::pair<uint256_t, uint64_t> chunk = uint256_max.divmod_word(10000000000000000000ULL);
+    EXPECT_EQ(chunk.first, uint256_t(0x0000000000000001ULL, 0xd83c94fb6d2ac34aULL, 0x5663d3c7a0d865caULL, 0x3c4ca40e0ea7cfe9ULL));
+    EXPECT_EQ(chunk.second, 0x693fcf03e3d7ffffULL);
+
+    EXPECT_THROW(val.divmod_word(0), std::domain_error);
+    EXPECT_THROW(val / 0, std::domain_error);
+}
+
 TEST(External, divide){
     bool      t    = true;
     bool      f    = false;
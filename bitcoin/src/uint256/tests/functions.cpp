@@ -59,6 +59,67 @@ TEST(Function, str){
     }
 }
 
+TEST(Function, to_chars){
+    const uint256_t original(2216002924);
+    for(std::pair <uint32_t const, std::string>  t : tests){
+        char buffer[32];
+        const std::to_chars_result result = to_chars(buffer, buffer + sizeof(buffer), original, t.first);
+        EXPECT_EQ(result.ec, std::errc());
+        EXPECT_EQ(std::string(buffer, result.ptr), t.second);
+    }
+
+    // every limb contributes digits
+    const uint256_t max(0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL);
+    char buffer[256];
+    std::to_chars_result result = to_chars(buffer, buffer + sizeof(buffer), max);
+    EXPECT_EQ(std::string(buffer, result.ptr), "115792089237316195423570985008687907853269984665640564039457584007913129639935");
+    result = to_chars(buffer, buffer + sizeof(buffer), max, 16);
+    EXPECT_EQ(std::string(buffer, result.ptr), std::string(64, 'f'));
+    result = to_chars(buffer, buffer + sizeof(buffer), max, 2);
+    EXPECT_EQ(std::string(buffer, result.ptr), std::string(256, '1'));
+    result = to_chars(buffer, buffer + sizeof(buffer), uint256_t(0), 7);
+    EXPECT_EQ(std::string(buffer, result.ptr), "0");
+
+    // buffer too small and invalid base
+    result = to_chars(buffer, buffer + 63, max, 16);
+    EXPECT_EQ(result.ec, std::errc::value_too_large);
+    EXPECT_EQ(result.ptr, buffer + 63);
+    result = to_chars(buffer, buffer + sizeof(buffer), max, 37);
+    EXPECT_EQ(result.ec, std::errc::invalid_argument);
+}
+
+TEST(Function, from_chars){
+    const uint256_t original(2216002924);
+    for(std::pair <uint32_t const, std::string>  t : tests){
+        uint256_t value;
+        const std::from_chars_result result = from_chars(t.second.data(), t.second.data() + t.second.size(), value, t.first);
+        EXPECT_EQ(result.ec, std::errc());
+        EXPECT_EQ(result.ptr, t.second.data() + t.second.size());
+        EXPECT_EQ(value, original);
+    }
+
+    // either case, stopping at the first character that is not a digit
+    const std::string hex = "DeadBeef0123456789abcdefABCDEF0123456789abcdefABCDEF0123456789ab-";
+    uint256_t value;
+    std::from_chars_result result = from_chars(hex.data(), hex.data() + hex.size(), value, 16);
+    EXPECT_EQ(result.ec, std::errc());
+    EXPECT_EQ(result.ptr, hex.data() + hex.size() - 1);
+    EXPECT_EQ(value, uint256_t(0xdeadbeef01234567ULL, 0x89abcdefabcdef01ULL, 0x23456789abcdefabULL, 0xcdef0123456789abULL));
+
+    // one past the maximum overflows, leaving the value untouched
+    const std::string big = "115792089237316195423570985008687907853269984665640564039457584007913129639936";
+    result = from_chars(big.data(), big.data() + big.size(), value);
+    EXPECT_EQ(result.ec, std::errc::result_out_of_range);
+    EXPECT_EQ(result.ptr, big.data() + big.size());
+    EXPECT_EQ(value, uint256_t(0xdeadbeef01234567ULL, 0x89abcdefabcdef01ULL, 0x23456789abcdefabULL, 0xcdef0123456789abULL));
+
+    // no digits
+    const std::string none = "xyz";
+    result = from_chars(none.data(), none.data() + none.size(), value, 10);
+    EXPECT_EQ(result.ec, std::errc::invalid_argument);
+    EXPECT_EQ(result.ptr, none.data());
+}
+
 TEST(Function, export_bits){
     const uint64_t u64 = 0x0123456789abcdefULL;
     const uint256_t value = u64;
@@ -107,3 +168,43 @@ TEST(External, ostream){
     std::stringstream zero; zero << uint256_t();
     EXPECT_EQ(zero.str(), "0");
 }
+
+TEST(Function, export_bits_zero){
+    EXPECT_EQ(uint256_t(0).export_bits(), std::vector<uint8_t>(32, 0));
+    EXPECT_EQ(uint256_t(0).export_bits_truncate(), std::vector<uint8_t>());
+}
+
+TEST(Function, write_read_bytes){
+    const uint256_t value(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL, 0x1011121314151617ULL, 0x18191a1b1c1d1e1fULL);
+
+    std::array<uint8_t, 32> be = {}, le = {};
+    value.write_be(be);
+    value.write_le(le);
+    for(uint8_t i = 0; i < 32; i++){
+        EXPECT_EQ(be[i], i);
+        EXPECT_EQ(le[i], 31 - i);
+    }
+
+    EXPECT_EQ(uint256_t::read_be(be), value);
+    EXPECT_EQ(uint256_t::read_le(le), value);
+    EXPECT_EQ(uint256_t::read_le(be), uint256_t::read_be(le));
+    EXPECT_EQ(std::vector<uint8_t>(be.begin(), be.end()), value.export_bits());
+
+    // Unaligned buffers through the pointer overloads
+    uint8_t buffer[33] = {};
+    uint256_max.write_le(buffer + 1);
+    EXPECT_EQ(buffer[0], 0);
+    EXPECT_EQ(uint256_t::read_le(buffer + 1), uint256_max);
+    value.write_be(buffer + 1);
+    EXPECT_EQ(uint256_t::read_be(buffer + 1), value);
+}
+
+TEST(Function, write_read_bytes_constexpr){
+    constexpr std::array<uint8_t, 32> bytes = {0xff, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                                               0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01};
+    constexpr uint256_t be = uint256_t::read_be(bytes);
+    constexpr uint256_t le = uint256_t::read_le(bytes);
+    static_assert(be == uint256_t(0xff00000000000000ULL, 0, 0, 1), "big endian read at compile time");
+    static_assert(le == uint256_t(0x0100000000000000ULL, 0, 0, 0xff), "little endian read at compile time");
+    EXPECT_EQ(be, uint256_t(0xff00000000000000ULL, 0, 0, 1));
+}
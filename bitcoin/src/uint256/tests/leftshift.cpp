@@ -25,6 +25,28 @@ TEST(BitShift, left){
     }
 }
 
+TEST(BitShift, left_native){
+    const uint256_t value(0x0123456789abcdefULL, 0xfedcba9876543210ULL, 0x0123456789abcdefULL, 0xfedcba9876543210ULL);
+
+    // every native count agrees with the uint256_t count
+    for(unsigned int shift = 0; shift <= 260; shift++){
+        EXPECT_EQ(value << shift, value << uint256_t(shift));
+        uint256_t copy = value;
+        EXPECT_EQ(copy <<= shift, value << uint256_t(shift));
+    }
+
+    EXPECT_EQ(value << 64U, uint256_t(0xfedcba9876543210ULL, 0x0123456789abcdefULL, 0xfedcba9876543210ULL, 0));
+    EXPECT_EQ(value << 4U, uint256_t(0x123456789abcdeffULL, 0xedcba98765432100ULL, 0x123456789abcdeffULL, 0xedcba98765432100ULL));
+    EXPECT_EQ(value << 256U, 0);
+    EXPECT_EQ(value << 4000000000U, 0);
+
+    // negative and oversized counts of other types shift everything out
+    EXPECT_EQ(value << -1, 0);
+    EXPECT_EQ(value << (int64_t) 256, 0);
+    EXPECT_EQ(value << (uint64_t) 0x100000004ULL, 0);
+    EXPECT_EQ(value << (uint8_t) 4, value << 4U);
+}
+
 TEST(External, shift_left){
     bool      t    = true;
     bool      f    = false;
@@ -13,6 +13,16 @@ TEST(Comparison, less_than){
     EXPECT_EQ(big < big,     false);
 }
 
+TEST(Comparison, less_than_limbs){
+    const uint256_t low (0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffffffffffffffULL);
+    const uint256_t high(0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000001ULL, 0x0000000000000000ULL);
+
+    // the most significant differing limb decides
+    EXPECT_EQ(low  < high, true);
+    EXPECT_EQ(high < low,  false);
+    EXPECT_EQ(low  < low,  false);
+}
+
 #define unsigned_compare_lt(Z)                                            \
 do                                                                        \
 {                                                                         \
@@ -17,6 +17,15 @@ TEST(Arithmetic, modulo){
     EXPECT_THROW(uint256_t(1) % uint256_t(0), std::domain_error);
 }
 
+TEST(Arithmetic, modulo_word){
+    const uint256_t val(0xfedcba9876543210ULL, 0xfedcba9876543210ULL, 0xfedcba9876543210ULL, 0xfedcba9876543210ULL);
+
+    EXPECT_EQ(val.mod_word(0x0123456789abcdefULL), 0xc91209c0ULL);
+    EXPECT_EQ(val % 0x0123456789abcdefULL, 0xc91209c0ULL);
+    EXPECT_EQ(uint256_max % 10000000000000000000ULL, 0x693fcf03e3d7ffffULL);
+    EXPECT_THROW(val.mod_word(0), std::domain_error);
+}
+
 TEST(External, modulo){
     bool      t    = true;
     bool      f    = false;
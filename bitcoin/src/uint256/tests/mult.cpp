@@ -16,6 +16,20 @@ TEST(Arithmetic, multiply){
     EXPECT_EQ(one * val, val);
 }
 
+TEST(Arithmetic, multiply_word){
+    const uint256_t val(0xfedcba9876543210ULL, 0xfedcba9876543210ULL, 0xfedcba9876543210ULL, 0xfedcba9876543210ULL);
+    const uint256_t expected(0x2358d29092d96432ULL, 0x2358d29092d96432ULL, 0x2358d29092d96432ULL, 0x2236d88fe5618cf0ULL);
+
+    EXPECT_EQ(val.mul_word(0x0123456789abcdefULL), expected);
+    EXPECT_EQ(val * 0x0123456789abcdefULL, expected);
+    EXPECT_EQ(val * 0x0123456789abcdefULL, val * uint256_t(0x0123456789abcdefULL));
+    EXPECT_EQ(val.mul_word(0), 0);
+    EXPECT_EQ(val.mul_word(1), val);
+
+    // negative values still multiply as their 256-bit two's complement
+    EXPECT_EQ(val * -1, -val);
+}
+
 TEST(External, multiply){
     bool      t    = true;
     bool      f    = false;
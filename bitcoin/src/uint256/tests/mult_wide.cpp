@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include "uint256_t.h"
+#include "uint512_t.hpp"
+
+TEST(Arithmetic, multiply_wide){
+    const uint256_t a(0xfedcba9876543210ULL, 0xfedcba9876543210ULL, 0xfedcba9876543210ULL, 0xfedcba9876543210ULL);
+    const uint256_t b(0x0123456789abcdefULL, 0x0123456789abcdefULL, 0x0123456789abcdefULL, 0x0123456789abcdefULL);
+
+    const std::pair<uint256_t, uint256_t> product = a.mul_wide(b);
+    EXPECT_EQ(product.first,  uint256_t(0x0121fa00ad77d742ULL, 0x247acc9140513b74ULL, 0x47d39f21d32a9fa6ULL, 0x6b2c71b2660403d8ULL));
+    EXPECT_EQ(product.second, uint256_t(0x8c4150419dedb986ULL, 0x68e87db10b145554ULL, 0x458fab20783af122ULL, 0x2236d88fe5618cf0ULL));
+
+    // the low half always matches the truncating multiply
+    EXPECT_EQ(product.second, a * b);
+
+    const std::pair<uint256_t, uint256_t> max = uint256_max.mul_wide(uint256_max);
+    EXPECT_EQ(max.first,  uint256_max - 1);
+    EXPECT_EQ(max.second, 1);
+
+    EXPECT_EQ(a.mul_wide(0).first, 0);
+    EXPECT_EQ(a.mul_wide(1).first, 0);
+    EXPECT_EQ(a.mul_wide(1).second, a);
+}
+
+TEST(Arithmetic, square){
+    const uint256_t a(0xfedcba9876543210ULL, 0xfedcba9876543210ULL, 0xfedcba9876543210ULL, 0xfedcba9876543210ULL);
+    const uint256_t b(0x0123456789abcdefULL, 0x0123456789abcdefULL, 0x0123456789abcdefULL, 0x0123456789abcdefULL);
+
+    // the square matches the product with itself, at both widths
+    uint256_t value = a;
+    for (int i = 0; i < 64; i++){
+        EXPECT_EQ(value.sqr_wide(), value.mul_wide(value));
+        EXPECT_EQ(value.sqr(), value * value);
+        value = (value ^ b) * a + uint256_t(i);
+    }
+    for (const uint256_t& edge : {uint256_0, uint256_1, uint256_max, uint256_t(1) << 255, uint256_max >> 1, uint256_t(0xffffffffffffffffULL)}){
+        EXPECT_EQ(edge.sqr_wide(), edge.mul_wide(edge));
+        EXPECT_EQ(edge.sqr(), edge * edge);
+    }
+
+    static_assert(uint256_t(0, 0, 1, 0).sqr_wide().second == uint256_t(0, 1, 0, 0), "squares are constexpr");
+}
+
+TEST(Arithmetic, uint512){
+    const uint512_t low(uint256_max);
+    const uint512_t high(1, 0);
+
+    EXPECT_EQ(low + uint512_t(1), high);
+    EXPECT_EQ(high - uint512_t(1), low);
+    EXPECT_EQ(high.upper(), 1);
+    EXPECT_EQ(high.lower(), 0);
+    EXPECT_EQ(high.bits(), 257);
+    EXPECT_TRUE(low < high);
+    EXPECT_FALSE(high < low);
+
+    EXPECT_EQ(high / uint256_t(2), uint512_t(uint256_t(1) << 255));
+    EXPECT_EQ(high % uint256_max, 1);
+    EXPECT_THROW(high % uint256_t(0), std::domain_error);
+
+    static_assert(uint512_t(1, 0) / uint256_t(2) == uint512_t(uint256_t(1) << 255), "uint512_t is a wide_uint<512>");
+    static_assert((uint512_t(1, 1) - uint512_t(2)).upper() == 0 && uint512_t(1, 0) % uint256_t(3) == 1, "so it is constexpr");
+}
+
+TEST(Arithmetic, mulmod){
+    // secp256k1 field prime
+    const uint256_t p(0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xfffffffefffffc2fULL);
+    const uint256_t a(0xfedcba9876543210ULL, 0xfedcba9876543210ULL, 0xfedcba9876543210ULL, 0xfedcba9876543210ULL);
+    const uint256_t b(0x0123456789abcdefULL, 0x0123456789abcdefULL, 0x0123456789abcdefULL, 0x0123456789abcdefULL);
+
+    EXPECT_EQ(mulmod(a, b, p), uint256_t(0x8c644419c8c50984ULL, 0xe1e06f7bc8ebdb3cULL, 0x375c9addc912acf3ULL, 0x8dfac0488d5f655dULL));
+    EXPECT_EQ(mulmod(p - 1, p - 1, p), 1);
+    EXPECT_EQ(mulmod(a, 0, p), 0);
+    EXPECT_EQ(mulmod(17, 19, 23), (17 * 19) % 23);
+}
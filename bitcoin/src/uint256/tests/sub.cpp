@@ -12,6 +12,14 @@ TEST(Arithmetic, subtract){
     EXPECT_EQ(big   - big,   0);
 }
 
+TEST(Arithmetic, subtract_borrow){
+    const uint256_t top(0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL);
+
+    // borrow ripples through every limb
+    EXPECT_EQ(top - 1, uint256_t(0x0000000000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL));
+    EXPECT_EQ(uint256_t(0) - 1, uint256_max);
+}
+
 TEST(External, subtract){
     bool     t    = true;
     bool     f    = false;
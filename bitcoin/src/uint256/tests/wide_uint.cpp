@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include "uint256_t.h"
+#include "uint512_t.hpp"
+#include "wide_uint.hpp"
+
+static_assert(sizeof(uint384_t) == 48, "no padding around the limbs");
+static_assert(sizeof(uint3072_t) == 384, "no padding around the limbs");
+static_assert((uint1024_t(1) << 1000) >> 1000 == uint1024_t(1), "shifts are constexpr");
+static_assert(uint384_t(0xffffffffffffffffULL).mul_wide(0xffffffffffffffffULL) == wide_uint<768>(uint256_t(0, 0, 0xfffffffffffffffeULL, 1)), "products are constexpr");
+
+TEST(WideUint, matches_uint256){
+    // wide_uint<256> runs the same algorithms as uint256_t, limb loop for limb loop
+    const uint256_t a(0xfedcba9876543210ULL, 0xfedcba9876543210ULL, 0xfedcba9876543210ULL, 0xfedcba9876543210ULL);
+    const uint256_t b(0x0123456789abcdefULL, 0x0123456789abcdefULL, 0x0123456789abcdefULL, 0x0123456789abcdefULL);
+    const wide_uint<256> wa(a), wb(b);
+
+    EXPECT_EQ(uint256_t(wa + wb), a + b);
+    EXPECT_EQ(uint256_t(wb - wa), b - a);
+    EXPECT_EQ(uint256_t(wa * wb), a * b);
+    EXPECT_EQ(uint256_t(wa / wb), a / b);
+    EXPECT_EQ(uint256_t(wa % wb), a % b);
+    EXPECT_EQ(uint256_t(wa & wb), a & b);
+    EXPECT_EQ(uint256_t(wa | wb), a | b);
+    EXPECT_EQ(uint256_t(wa ^ wb), a ^ b);
+    EXPECT_EQ(uint256_t(~wa), ~a);
+    EXPECT_EQ(uint256_t(-wa), -a);
+    for(unsigned int shift : {0, 1, 63, 64, 65, 128, 200, 255, 256}){
+        EXPECT_EQ(uint256_t(wa << shift), a << shift);
+        EXPECT_EQ(uint256_t(wa >> shift), a >> shift);
+    }
+    EXPECT_EQ(wa.bits(), a.bits());
+    EXPECT_EQ(wa.str(16), a.str(16));
+    EXPECT_EQ(wb.str(), b.str());
+
+    const std::pair<uint256_t, uint256_t> product = a.mul_wide(b);
+    const wide_uint<512> wide = wa.mul_wide(wb);
+    EXPECT_EQ(uint256_t(wide), product.second);
+    EXPECT_EQ(uint256_t(wide >> 256), product.first);
+    EXPECT_EQ(wide, wide_uint<512>(uint512_t(product)));
+}
+
+TEST(WideUint, compare){
+    const uint384_t one(1);
+    const uint384_t top = one << 383;
+
+    EXPECT_TRUE(one < top);
+    EXPECT_TRUE(top > one);
+    EXPECT_TRUE(one <= one);
+    EXPECT_TRUE(top >= one);
+    EXPECT_FALSE(top < one);
+    EXPECT_TRUE(one != top);
+    EXPECT_EQ(top.bits(), 384);
+    EXPECT_TRUE(top.test_bit(383));
+    EXPECT_FALSE(top.test_bit(382));
+    EXPECT_FALSE(top.test_bit(384));
+    EXPECT_FALSE(uint384_t());
+    EXPECT_EQ(uint384_t().bits(), 0);
+}
+
+TEST(WideUint, carries){
+    const uint3072_t max = ~uint3072_t();
+
+    EXPECT_EQ(max + 1, uint3072_t());
+    EXPECT_EQ(uint3072_t() - 1, max);
+    EXPECT_EQ(max.bits(), 3072);
+    EXPECT_EQ(max.limb(47), 0xffffffffffffffffULL);
+    EXPECT_EQ(max.limb(48), 0);
+
+    // (2^n - 1)^2 = 2^2n - 2^(n+1) + 1
+    const wide_uint<6144> square = max.mul_wide(max);
+    EXPECT_EQ(square, (wide_uint<6144>(1) << 6144) - (wide_uint<6144>(1) << 3073) + 1);
+    EXPECT_EQ(max * max, uint3072_t(1));
+
+    // Width changes truncate or zero extend
+    EXPECT_EQ(uint384_t(max), ~uint384_t());
+    EXPECT_EQ(uint3072_t(~uint384_t()), (uint3072_t(1) << 384) - 1);
+}
+
+TEST(WideUint, divmod){
+    const uint1024_t a = (uint1024_t(0x0123456789abcdefULL) << 900) + (uint1024_t(0xfedcba9876543210ULL) << 300) + 12345;
+    const uint1024_t b = (uint1024_t(0xfedcba9876543210ULL) << 400) + 7;
+
+    const std::pair<uint1024_t, uint1024_t> qr = uint1024_t::divmod(a, b);
+    EXPECT_EQ(qr.first * b + qr.second, a);
+    EXPECT_TRUE(qr.second < b);
+
+    EXPECT_EQ(a / a, uint1024_t(1));
+    EXPECT_EQ(a % a, uint1024_t());
+    EXPECT_EQ(b / a, uint1024_t());
+    EXPECT_EQ(b % a, b);
+    EXPECT_EQ(a / 1, a);
+    EXPECT_EQ((a * 10) / 10, a);
+    EXPECT_THROW(a / uint1024_t(), std::domain_error);
+    EXPECT_THROW(a.str(1), std::invalid_argument);
+
+    EXPECT_EQ((uint1024_t(1) << 200).str(), "1606938044258990275541962092341162602522202993782792835301376");
+    EXPECT_EQ((uint1024_t(1) << 200).str(2), "1" + std::string(200, '0'));
+}
+
+TEST(WideUint, mulmod){
+    // 2^3072 - 1103717 is the MuHash prime
+    const uint3072_t p = uint3072_t() - 1103717;
+    const uint3072_t a = p - 1;
+
+    EXPECT_EQ(mulmod(a, a, p), uint3072_t(1));
+    EXPECT_EQ(mulmod(a, uint3072_t(2), p), p - 2);
+    EXPECT_EQ(mulmod(uint3072_t(1103717), uint3072_t() - 1, p), uint3072_t(1103716) * 1103717 % p);
+}